@@ -21,7 +21,7 @@ def load_general_data(facade, observation_key, case_name, include_data=True):
     obs_vector = facade.get_observations()[observation_key]
     data_key = obs_vector.getDataKey()
 
-    data = pd.DataFrame()
+    data = []
 
     for time_step in obs_vector.getStepList().asList():
         # Fetch, then transpose the simulation data in order to make it
@@ -40,13 +40,17 @@ def load_general_data(facade, observation_key, case_name, include_data=True):
         node = obs_vector.getNode(time_step)
         index_list = [node.getIndex(nr) for nr in range(len(node))]
 
-        data = data.append(
-            pd.DataFrame([node.get_data_points()], columns=index_list, index=["OBS"])
-        ).append(pd.DataFrame([node.get_std()], columns=index_list, index=["STD"]))
+        data.append(
+            pd.DataFrame(
+                [node.get_data_points(), node.get_std()],
+                columns=index_list,
+                index=["OBS", "STD"],
+            )
+        )
         if include_data:
-            gen_data = facade.load_gen_data(case_name, data_key, time_step).T
-            data = data.append(gen_data)
-    return data
+            data.append(facade.load_gen_data(case_name, data_key, time_step).T)
+
+    return _concat_blocks(data)
 
 
 def load_block_data(facade, observation_key, case_name, include_data=True):
@@ -58,41 +62,55 @@ def load_block_data(facade, observation_key, case_name, include_data=True):
     obs_vector = facade.get_observations()[observation_key]
     loader = facade.create_plot_block_data_loader(obs_vector)
 
-    data = pd.DataFrame()
+    data = []
     for report_step in obs_vector.getStepList().asList():
         obs_block = loader.getBlockObservation(report_step)
 
-        data = data.append(
-            pd.DataFrame([[obs_block.getValue(i) for i in obs_block]], index=["OBS"])
-        ).append(
-            pd.DataFrame([[obs_block.getStd(i) for i in obs_block]], index=["STD"])
+        data.append(
+            pd.DataFrame(
+                [
+                    [obs_block.getValue(i) for i in obs_block],
+                    [obs_block.getStd(i) for i in obs_block],
+                ],
+                index=["OBS", "STD"],
+            )
         )
 
         if include_data:
             block_data = loader.load(facade.get_current_fs(), report_step)
-            data = data.append(
-                _get_block_measured(facade.get_ensemble_size(), block_data)
-            )
+            data.append(_get_block_measured(facade.get_ensemble_size(), block_data))
 
-    return data
+    return _concat_blocks(data)
 
 
 def _get_block_measured(ensamble_size, block_data):
-    data = pd.DataFrame()
-    for ensamble_nr in range(ensamble_size):
-        data = data.append(pd.DataFrame([block_data[ensamble_nr]], index=[ensamble_nr]))
-    return data
+    return pd.DataFrame(
+        [list(block_data[ensamble_nr]) for ensamble_nr in range(ensamble_size)],
+        index=range(ensamble_size),
+    )
+
+
+def _concat_blocks(blocks):
+    """
+    Stacks the blocks collected per time step in one go. Appending them one
+    by one copies everything accumulated so far, which is quadratic in the
+    number of time steps and realizations.
+    """
+    if not blocks:
+        return pd.DataFrame()
+    return pd.concat(blocks, sort=True)
 
 
 def load_summary_data(facade, observation_key, case_name, include_data=True):
+    if not include_data:
+        return _get_indexed_summary_observations(facade, observation_key)
+
     data_key = facade.get_data_key_for_obs_key(observation_key)
     args = (facade, observation_key, data_key, case_name)
-    data = []
-    if include_data:
-        data.append(_get_summary_data(*args))
-    data.append(
-        _get_summary_observations(*args).pipe(_remove_inactive_report_steps, *args)
-    )
+    data = [
+        _get_summary_data(*args),
+        _get_summary_observations(*args).pipe(_remove_inactive_report_steps, *args),
+    ]
     return pd.concat(data)
 
 
@@ -112,6 +130,18 @@ def _get_summary_observations(facade, _, data_key, case_name):
     return data
 
 
+def _get_indexed_summary_observations(facade, observation_key):
+    # Only the observations are wanted, so they are taken from the observation
+    # index instead of going through the case storage and trimming away the
+    # other observations on the data key.
+    observation = facade.get_observation_index()[observation_key]
+    return pd.DataFrame(
+        [observation.values, observation.stds],
+        index=["OBS", "STD"],
+        columns=observation.key_indexes,
+    )
+
+
 def _remove_inactive_report_steps(data, facade, observation_key, *args):
     # XXX: the data returned from the SummaryObservationCollector is not
     # specific to an observation_key, this means that the dataset contains all
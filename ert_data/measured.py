@@ -1,15 +1,30 @@
+import numpy as np
 import pandas as pd
 
 from ert_data import loader
 
 
 class MeasuredData(object):
+    """
+    The loaded data is kept as one immutable matrix together with a row and
+    a column mask. The removal and filter methods only narrow the masks, and
+    the data frame is materialized once, the first time data is requested
+    after a change.
+    """
+
     def __init__(self, facade, keys, index_lists=None):
         self._facade = facade
         self._set_data(self._get_data(keys, index_lists))
 
     @property
     def data(self):
+        if self._data is None:
+            rows, columns = self._row_mask, self._column_mask
+            self._data = pd.DataFrame(
+                self._values[np.ix_(rows, columns)],
+                index=self._index[rows],
+                columns=self._columns[columns],
+            )
         return self._data
 
     def _set_data(self, data):
@@ -25,10 +40,30 @@ class MeasuredData(object):
                 )
             )
         else:
+            self._values = np.array(data.values, dtype=float)
+            self._values.flags.writeable = False
+            self._index = data.index
+            self._columns = data.columns
+            self._simulated_rows = ~data.index.isin(expected_keys)
+            self._row_mask = np.ones(len(data.index), dtype=bool)
+            self._column_mask = np.ones(len(data.columns), dtype=bool)
             self._data = data
 
+    def _set_masks(self, row_mask=None, column_mask=None):
+        if row_mask is not None:
+            self._row_mask = row_mask
+        if column_mask is not None:
+            self._column_mask = column_mask
+        self._data = None
+
+    def _active_values(self, rows):
+        """Values for the given rows among the active rows and columns,
+        together with the positions of the active columns."""
+        columns = np.flatnonzero(self._column_mask)
+        return self._values[np.ix_(rows & self._row_mask, columns)], columns
+
     def remove_failed_realizations(self):
-        self._set_data(self._remove_failed_realizations())
+        self._set_masks(row_mask=self._remove_failed_realizations())
 
     def get_simulated_data(self):
         return self._get_simulated_data()
@@ -39,25 +74,26 @@ class MeasuredData(object):
     def _remove_failed_realizations(self):
         """Removes rows with no simulated data, leaving observations and
         standard deviations as-is."""
-        pre_index = self.data.index
-        post_index = list(self.data.dropna(axis=0, how="all").index)
-        drop_index = set(pre_index) - set(post_index + ["STD", "OBS"])
-        return self.data.drop(index=drop_index)
+        values = self._values[:, self._column_mask]
+        failed = self._simulated_rows & np.isnan(values).all(axis=1)
+        return self._row_mask & ~failed
 
     def remove_inactive_observations(self):
-        self._set_data(self._remove_inactive_observations())
+        self._set_masks(column_mask=self._remove_inactive_observations())
 
     def _remove_inactive_observations(self):
         """Removes columns with one or more NaN values."""
-        filtered_dataset = self.data.dropna(axis=1)
-        if filtered_dataset.empty:
+        values, columns = self._active_values(self._row_mask)
+        column_mask = np.zeros_like(self._column_mask)
+        column_mask[columns[~np.isnan(values).any(axis=0)]] = True
+        if not column_mask.any():
             raise ValueError(
                 "This operation results in an empty dataset (could be due to one or more failed realizations)"
             )
-        return filtered_dataset
+        return column_mask
 
     def is_empty(self):
-        return self.data.empty
+        return not (self._row_mask.any() and self._column_mask.any())
 
     def _get_data(self, observation_keys, index_lists):
         """
@@ -65,7 +101,7 @@ class MeasuredData(object):
         members will have a data key, observed data will be named OBS and
         observed standard deviation will be named STD.
         """
-        measured_data = pd.DataFrame()
+        measured_data = []
         case_name = self._facade.get_current_case_name()
 
         if index_lists is None:
@@ -85,18 +121,20 @@ class MeasuredData(object):
             # helpful
             _add_index_range(data)
 
-            data = MeasuredData._filter_on_column_index(data, index_list)
-            data = pd.concat({key: data}, axis=1)
+            measured_data.append(MeasuredData._filter_on_column_index(data, index_list))
 
-            measured_data = pd.concat([measured_data, data], axis=1)
+        # The blocks are joined in a single concat, growing the frame one key
+        # at a time would copy everything accumulated so far on every step.
+        if not measured_data:
+            return pd.DataFrame()
 
-        return measured_data.astype(float)
+        return pd.concat(measured_data, axis=1, keys=observation_keys).astype(float)
 
     def filter_ensemble_std(self, std_cutoff):
-        self._set_data(self._filter_ensemble_std(std_cutoff))
+        self._set_masks(column_mask=self._filter_ensemble_std(std_cutoff))
 
     def filter_ensemble_mean_obs(self, alpha):
-        self._set_data(self._filter_ensemble_mean_obs(alpha))
+        self._set_masks(column_mask=self._filter_ensemble_mean_obs(alpha))
 
     def _filter_ensemble_std(self, std_cutoff):
         """
@@ -104,23 +142,30 @@ class MeasuredData(object):
         deviation cutoff. If there is not enough variation in the measurements
         the data point is removed.
         """
-        ens_std = self.get_simulated_data().std()
-        std_filter = ens_std <= std_cutoff
-        return self.data.drop(columns=std_filter[std_filter].index)
+        simulated, columns = self._active_values(self._simulated_rows)
+        ens_std = pd.DataFrame(simulated).std().values
+        return self._drop_columns(columns[ens_std <= std_cutoff])
 
     def _filter_ensemble_mean_obs(self, alpha):
         """
         Filters on distance between the observed data and the ensamble mean
         based on variation and a user defined alpha.
         """
-        ens_mean = self.get_simulated_data().mean()
-        ens_std = self.get_simulated_data().std()
-        obs_values = self.data.loc["OBS"]
-        obs_std = self.data.loc["STD"]
+        simulated, columns = self._active_values(self._simulated_rows)
+        simulated = pd.DataFrame(simulated)
+        ens_mean = simulated.mean().values
+        ens_std = simulated.std().values
+        obs_values = self._values[self._index.get_loc("OBS"), columns]
+        obs_std = self._values[self._index.get_loc("STD"), columns]
 
         mean_filter = abs(obs_values - ens_mean) > alpha * (ens_std + obs_std)
 
-        return self.data.drop(columns=mean_filter[mean_filter].index)
+        return self._drop_columns(columns[mean_filter])
+
+    def _drop_columns(self, columns):
+        column_mask = self._column_mask.copy()
+        column_mask[columns] = False
+        return column_mask
 
     @staticmethod
     def _filter_on_column_index(dataframe, index_list):
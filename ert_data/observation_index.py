@@ -0,0 +1,56 @@
+from collections import namedtuple
+
+import numpy as np
+
+
+ObservationEntry = namedtuple("ObservationEntry", ["values", "stds", "key_indexes"])
+
+
+class ObservationIndex(object):
+    """
+    Summary observation values, standard deviations and dates per
+    observation key, read from the observation configuration and kept as
+    NumPy arrays. Each key is resolved the first time it is requested and
+    reused after that, so looking up observations never touches case
+    storage.
+
+    key_indexes are the dates used as columns in the loaded data. General
+    and block observations are read from the observation configuration by
+    their loaders already, so they are not indexed.
+    """
+
+    def __init__(self, facade):
+        self._facade = facade
+        self._entries = {}
+
+    def __getitem__(self, observation_key):
+        if observation_key not in self._entries:
+            self._entries[observation_key] = self._create_entry(observation_key)
+        return self._entries[observation_key]
+
+    def __contains__(self, observation_key):
+        return observation_key in self._facade.get_observations()
+
+    def _create_entry(self, observation_key):
+        observation_type = self._facade.get_impl_type_name_for_obs_key(observation_key)
+        if observation_type != "SUMMARY_OBS":
+            raise TypeError(
+                "Only summary observations are indexed, not: {}".format(
+                    observation_type
+                )
+            )
+
+        observations = self._facade.get_observations()
+        obs_vector = observations[observation_key]
+        values, stds, dates = [], [], []
+        for step in obs_vector.getStepList().asList():
+            node = obs_vector.getNode(step)
+            values.append(node.getValue())
+            stds.append(node.getStandardDeviation())
+            dates.append(observations.getObservationTime(step).datetime())
+
+        return ObservationEntry(
+            values=np.array(values, dtype=float),
+            stds=np.array(stds, dtype=float),
+            key_indexes=np.array(dates),
+        )
@@ -1,19 +1,51 @@
+from collections import OrderedDict
+
 import numpy
-from scipy.stats import gaussian_kde
 from .plot_tools import PlotTools
 
 
+class KDECache(object):
+    """
+    Evaluated KDEs by (case, key, bandwidth), keeping only the @max_size
+    most recently used ones.
+    """
+
+    def __init__(self, max_size=64):
+        self._max_size = max_size
+        self._entries = OrderedDict()
+
+    def __len__(self):
+        return len(self._entries)
+
+    def get(self, cache_key):
+        value = self._entries.pop(cache_key, None)
+        if value is not None:
+            self._entries[cache_key] = value
+        return value
+
+    def __setitem__(self, cache_key, value):
+        self._entries.pop(cache_key, None)
+        self._entries[cache_key] = value
+        while len(self._entries) > self._max_size:
+            self._entries.popitem(last=False)
+
+    def clear(self):
+        self._entries.clear()
+
+
 class GaussianKDEPlot(object):
     def __init__(self):
         self.dimensionality = 1
+        self._kde_cache = KDECache()
 
     def plot(self, figure, plot_context, case_to_data_map, _observation_data):
-        plotGaussianKDE(figure, plot_context, case_to_data_map, _observation_data)
+        plotGaussianKDE(figure, plot_context, case_to_data_map, _observation_data, self._kde_cache)
 
 
-def plotGaussianKDE(figure, plot_context, case_to_data_map, _observation_data):
+def plotGaussianKDE(figure, plot_context, case_to_data_map, _observation_data, kde_cache=None):
     """
     @type plot_context: ert_gui.plottery.PlotContext
+    @type kde_cache: KDECache
     """
     key = plot_context.key()
     config = plot_context.plotConfig()
@@ -33,28 +65,86 @@ def plotGaussianKDE(figure, plot_context, case_to_data_map, _observation_data):
             continue
         data = data[0]
         if data.nunique() > 1:
-            _plotGaussianKDE(axes, config, data, case)
+            _plotGaussianKDE(axes, config, data, case, key, kde_cache)
             config.nextColor()
 
     PlotTools.finalizePlot(plot_context, figure, axes, default_x_label="Value", default_y_label="Density")
 
 
-def _plotGaussianKDE(axes, plot_config, data, label):
+def _plotGaussianKDE(axes, plot_config, data, label, key=None, kde_cache=None):
     """
     @type axes: matplotlib.axes.Axes
     @type plot_config: PlotConfig
     @type data: DataFrame
     @type label: Str
+    @type key: Str
+    @type kde_cache: KDECache
     """
 
     style = plot_config.histogramStyle()
 
-    sample_range = data.max() - data.min()
-    indexes = numpy.linspace(data.min() - 0.5 * sample_range, data.max() + 0.5 * sample_range, 1000)
-    gkde = gaussian_kde(data.values)
-    evaluated_gkde = gkde.evaluate(indexes)
+    values = data.values.astype(float)
+    bandwidth = scottBandwidth(values)
+
+    cache_key = (label, key, bandwidth)
+    cached = kde_cache.get(cache_key) if kde_cache is not None else None
+
+    if cached is not None and numpy.array_equal(cached[0], values):
+        indexes, evaluated_gkde = cached[1], cached[2]
+    else:
+        indexes, evaluated_gkde = binnedGaussianKDE(values, bandwidth)
+        if kde_cache is not None:
+            kde_cache[cache_key] = (values, indexes, evaluated_gkde)
 
     lines = axes.plot(indexes, evaluated_gkde, linewidth=style.width, color=style.color, alpha=style.alpha)
 
     if len(lines) > 0:
         plot_config.addLegendItem(label, lines[0])
+
+
+def scottBandwidth(values):
+    """
+    Kernel standard deviation according to Scott's rule. This is the same
+    bandwidth scipy.stats.gaussian_kde uses by default for 1D data.
+    @type values: numpy.ndarray
+    @rtype: float
+    """
+    return float(numpy.std(values, ddof=1) * len(values) ** (-1.0 / 5.0))
+
+
+def binnedGaussianKDE(values, bandwidth, grid_size=1024):
+    """
+    Gaussian KDE evaluated on an evenly spaced grid covering the sample range
+    extended by half the range on each side. The samples are linearly binned
+    onto the grid and convolved with the kernel using FFT, which costs
+    O(N + G log G) instead of the O(N * G) of a direct evaluation.
+    @type values: numpy.ndarray
+    @type bandwidth: float
+    @type grid_size: int
+    @rtype: (numpy.ndarray, numpy.ndarray)
+    """
+    minimum = values.min()
+    maximum = values.max()
+    sample_range = maximum - minimum
+    lower = minimum - 0.5 * sample_range
+    upper = maximum + 0.5 * sample_range
+
+    grid = numpy.linspace(lower, upper, grid_size)
+    delta = grid[1] - grid[0]
+
+    position = (values - lower) / delta
+    left = numpy.clip(numpy.floor(position).astype(int), 0, grid_size - 2)
+    weight = position - left
+    counts = numpy.bincount(left, weights=1.0 - weight, minlength=grid_size)
+    counts += numpy.bincount(left + 1, weights=weight, minlength=grid_size)
+
+    kernel_half_width = min(int(numpy.ceil(5.0 * bandwidth / delta)), grid_size - 1)
+    kernel_x = numpy.arange(-kernel_half_width, kernel_half_width + 1) * delta
+    kernel = numpy.exp(-0.5 * (kernel_x / bandwidth) ** 2) / (bandwidth * numpy.sqrt(2.0 * numpy.pi))
+
+    convolution_size = grid_size + len(kernel) - 1
+    fft_size = 1 << int(numpy.ceil(numpy.log2(convolution_size)))
+    convolved = numpy.fft.irfft(numpy.fft.rfft(counts, fft_size) * numpy.fft.rfft(kernel, fft_size), fft_size)
+    density = convolved[kernel_half_width:kernel_half_width + grid_size] / len(values)
+
+    return grid, numpy.clip(density, 0.0, None)
@@ -1,7 +1,7 @@
 import math
 import time
 
-from qtpy.QtCore import Signal, Qt, QAbstractTableModel
+from qtpy.QtCore import Signal, Qt, QAbstractTableModel, QRectF
 from qtpy.QtWidgets import (
     QDialog,
     QFrame,
@@ -21,18 +21,43 @@ from ert_gui.tools.file import FileDialog
 
 
 class DetailedProgress(QFrame):
+    """Shows the forward model job statuses of every realization in a grid.
+
+    The job statuses are rendered into an image with one pixel per job,
+    which is kept between paint events. A progress update only redraws the
+    realizations that changed, and only their cells are repainted. The image
+    is rendered from scratch when the grid layout changes, e.g. on resize.
+    Realization numbers are left out when the cells are too small to fit
+    them."""
+
     clicked = Signal(int)
 
+    BORDER_THICKNESS = 4
+    MIN_LABEL_CELL_WIDTH = 24
+    MIN_LABEL_CELL_HEIGHT = 16
+
+    # Results of _update_layout
+    LAYOUT_UNCHANGED = 0
+    LAYOUT_CHANGED = 1
+    NO_IMAGE = 2
+
     def __init__(self, state_colors, parent):
         super(DetailedProgress, self).__init__(parent)
         self.setLineWidth(1)
 
         self.state_colors = state_colors
+        self._state_pixels = {state: QColor(*color).rgb() for state, color in state_colors.items()}
         self._current_iteration = 0
-        self._current_progress = []
+        self._current_progress = {}
+        # Grown as progress arrives, so the layout does not scan every
+        # realization on each update
+        self._nr_realizations = 0
+        self._fm_size = 0
         self.selected_realization = -1
         self.grid_height = -1
         self.grid_width = -1
+        self._sub_grid_size = -1
+        self._foreground_image = None
 
     def mousePressEvent(self, event):
         super(DetailedProgress, self).mousePressEvent(event)
@@ -42,9 +67,11 @@ class DetailedProgress(QFrame):
         y = int((float(position.y()) / self.height()) * self.grid_height)
         index = y * self.grid_width + x
 
+        previous = self.selected_realization
         self.selected_realization = index
         self.clicked.emit(index)
-        self.update()
+        self._update_cell(previous)
+        self._update_cell(index)
 
     def draw_window(self, x, y, progress, render_image):
         nr_jobs = len(progress)
@@ -53,15 +80,83 @@ class DetailedProgress(QFrame):
         for index, job in enumerate(progress):
             y_off = int(index / grid_size)
             x_off = index - (y_off * grid_size)
-            color = QColor(*self.state_colors[job.status])
-            render_image.setPixel(x + x_off, y + y_off, color.rgb())
+            render_image.setPixel(x + x_off, y + y_off, self._state_pixels[job.status])
 
     def set_progress(self, progress, iteration):
+        """Updates the realizations in @progress, leaving the others as
+        they are."""
         self.setMinimumHeight(200)
-        self._current_progress = sorted([(iens, jobs, status) for iens, (jobs, status) in progress.items()],
-                                        key=lambda x: x[0])
+        self._current_progress.update(progress)
         self._current_iteration = iteration
+        if progress:
+            self._nr_realizations = max(self._nr_realizations, max(progress) + 1)
+            self._fm_size = max(self._fm_size, max(len(jobs) for jobs, _ in progress.values()))
+
+        if self._update_layout() == DetailedProgress.LAYOUT_UNCHANGED:
+            for iens in progress:
+                self._draw_realization(iens, clear=True)
+                self._update_cell(iens)
+
+    def resizeEvent(self, event):
+        super(DetailedProgress, self).resizeEvent(event)
+        self._update_layout()
+
+    def _update_layout(self):
+        """Computes the grid for the current size and realizations. Returns
+        LAYOUT_CHANGED and schedules a full repaint if the grid changed, and
+        NO_IMAGE if there is nothing to lay out or no room to do it in. The
+        image is then dropped, so it is rendered from scratch once there
+        is."""
+        if not self._current_progress or self.width() <= 0 or self.height() <= 0:
+            self._foreground_image = None
+            return DetailedProgress.NO_IMAGE
+
+        aspect_ratio = float(self.width()) / self.height()
+        grid_height = int(math.ceil(math.sqrt(self._nr_realizations / aspect_ratio)))
+        grid_width = int(math.ceil(grid_height * aspect_ratio))
+        sub_grid_size = int(math.ceil(math.sqrt(self._fm_size)))
+
+        layout = (grid_width, grid_height, sub_grid_size)
+        if self._foreground_image is not None and layout == (self.grid_width, self.grid_height, self._sub_grid_size):
+            return DetailedProgress.LAYOUT_UNCHANGED
+
+        self.grid_width, self.grid_height, self._sub_grid_size = layout
+        self._foreground_image = QImage(grid_width * sub_grid_size, grid_height * sub_grid_size,
+                                        QImage.Format_ARGB32)
+        self._foreground_image.fill(QColor(0, 0, 0, 0))
+        for iens in self._current_progress:
+            self._draw_realization(iens)
+
         self.update()
+        return DetailedProgress.LAYOUT_CHANGED
+
+    def _cell_position(self, iens):
+        y = int(iens / self.grid_width)
+        x = int(iens - (y * self.grid_width))
+        return x, y
+
+    def _cell_size(self):
+        return float(self.width()) / self.grid_width, float(self.height()) / self.grid_height
+
+    def _draw_realization(self, iens, clear=False):
+        progress, _ = self._current_progress[iens]
+        x, y = self._cell_position(iens)
+        sub_grid_size = self._sub_grid_size
+
+        if clear:
+            transparent = QColor(0, 0, 0, 0).rgba()
+            for y_off in range(sub_grid_size):
+                for x_off in range(sub_grid_size):
+                    self._foreground_image.setPixel(x * sub_grid_size + x_off, y * sub_grid_size + y_off, transparent)
+        self.draw_window(x * sub_grid_size, y * sub_grid_size, progress, self._foreground_image)
+
+    def _update_cell(self, iens):
+        if iens < 0 or self._foreground_image is None:
+            return
+
+        x, y = self._cell_position(iens)
+        cell_width, cell_height = self._cell_size()
+        self.update(QRectF(x * cell_width, y * cell_height, cell_width, cell_height).toAlignedRect())
 
     def has_realization_failed(self, progress):
         for job in progress:
@@ -72,55 +167,50 @@ class DetailedProgress(QFrame):
 
     def paintEvent(self, event):
         super(DetailedProgress, self).paintEvent(event)
-        if not self._current_progress:
+        if not self._current_progress or self._foreground_image is None:
             return
 
         painter = QPainter(self)
-        width = self.width()
-        height = self.height()
-        aspect_ratio = float(width) / height
-        nr_realizations = max([iens for iens, _, _ in self._current_progress]) + 1
-        fm_size = max([len(progress) for _, progress, _ in self._current_progress])
-        self.grid_height = math.ceil(math.sqrt(nr_realizations / aspect_ratio))
-        self.grid_width = math.ceil(self.grid_height * aspect_ratio)
-        sub_grid_size = math.ceil(math.sqrt(fm_size))
-        cell_height = height / self.grid_height
-        cell_width = width / self.grid_width
-
-        foreground_image = QImage(self.grid_width * sub_grid_size, self.grid_height * sub_grid_size,
-                                  QImage.Format_ARGB32)
-        foreground_image.fill(QColor(0, 0, 0, 0))
-
-        for index, (iens, progress, _) in enumerate(self._current_progress):
-            y = int(iens / self.grid_width)
-            x = int(iens - (y * self.grid_width))
-            self.draw_window(x * sub_grid_size, y * sub_grid_size, progress, foreground_image)
-            painter.drawImage(self.contentsRect(), foreground_image)
-
-        for index, (iens, progress, state) in enumerate(self._current_progress):
-            y = int(iens / self.grid_width)
-            x = int(iens - (y * self.grid_width))
-
-            painter.setPen(QColor(80, 80, 80))
-            painter.drawText(x * cell_width, y * cell_height, cell_width, cell_height,
-                             Qt.AlignHCenter | Qt.AlignVCenter, str(iens))
-
-            if iens == self.selected_realization:
-                pen = QPen(QColor(240, 240, 240))
-            elif (self.has_realization_failed(progress)):
-                pen = QPen(QColor(*self.state_colors['Failure']))
-            elif (state == JobStatusType.JOB_QUEUE_RUNNING):
-                pen = QPen(QColor(*self.state_colors['Running']))
-            else:
-                pen = QPen(QColor(80, 80, 80))
-
-            thickness = 4
-            pen.setWidth(thickness)
-            painter.setPen(pen)
-            painter.drawRect((x * cell_width) + (thickness / 2),
-                             (y * cell_height) + (thickness / 2),
-                             cell_width - (thickness - 1),
-                             cell_height - (thickness - 1))
+        painter.drawImage(self.contentsRect(), self._foreground_image)
+
+        cell_width, cell_height = self._cell_size()
+        draw_labels = cell_width >= self.MIN_LABEL_CELL_WIDTH and cell_height >= self.MIN_LABEL_CELL_HEIGHT
+
+        # Only the cells overlapping the region to repaint are drawn
+        region = event.rect()
+        first_column = max(0, int(region.left() / cell_width))
+        last_column = min(self.grid_width - 1, int(region.right() / cell_width))
+        first_row = max(0, int(region.top() / cell_height))
+        last_row = min(self.grid_height - 1, int(region.bottom() / cell_height))
+
+        thickness = self.BORDER_THICKNESS
+        for y in range(first_row, last_row + 1):
+            for x in range(first_column, last_column + 1):
+                iens = y * self.grid_width + x
+                if iens not in self._current_progress:
+                    continue
+                progress, state = self._current_progress[iens]
+                cell = QRectF(x * cell_width, y * cell_height, cell_width, cell_height)
+
+                if draw_labels:
+                    painter.setPen(QColor(80, 80, 80))
+                    painter.drawText(cell, Qt.AlignHCenter | Qt.AlignVCenter, str(iens))
+
+                if iens == self.selected_realization:
+                    pen = QPen(QColor(240, 240, 240))
+                elif (self.has_realization_failed(progress)):
+                    pen = QPen(QColor(*self.state_colors['Failure']))
+                elif (state == JobStatusType.JOB_QUEUE_RUNNING):
+                    pen = QPen(QColor(*self.state_colors['Running']))
+                else:
+                    pen = QPen(QColor(80, 80, 80))
+
+                pen.setWidth(thickness)
+                painter.setPen(pen)
+                painter.drawRect(QRectF((x * cell_width) + (thickness / 2.0),
+                                        (y * cell_height) + (thickness / 2.0),
+                                        cell_width - (thickness - 1),
+                                        cell_height - (thickness - 1)))
 
 
 class SingleProgressModel(QAbstractTableModel):
@@ -272,7 +362,6 @@ class DetailedProgressWidget(QWidget):
 
         self.layout().setRowStretch(1, 1)
         self.layout().setRowStretch(3, 1)
-        self.progress = None
         self.selected_realization = -1
         self.current_iteration = -1
         self.resize(parent.width(), parent.height())
@@ -280,22 +369,20 @@ class DetailedProgressWidget(QWidget):
         self._iter_to_tab = {}
 
     def set_progress(self, progress, iteration):
+        """Updates the realizations in @progress, which may hold only the
+        realizations that changed since the previous call."""
         if iteration < 0:
             return
 
-        self.progress = progress
-        for i in progress:  # create all detailed views if they havent been constructed yet
-            if i in self._iter_to_tab:
-                continue
-            detailed_progress_widget = DetailedProgress(self.state_colors, self)
-            detailed_progress_widget.clicked.connect(self.show_selection)
-            detailed_progress_widget.set_progress(progress[i], i)
-            detailed_progress_widget.show()
-            self._iter_to_tab[i] = self.iterations.addTab(detailed_progress_widget,
-                                                          "Realizations for iteration {}".format(i))
-
-        current_progress_widget = self.iterations.widget(self._iter_to_tab[iteration])
-        current_progress_widget.set_progress(progress[iteration], iteration)
+        for i in progress:
+            self.progress.setdefault(i, {}).update(progress[i])
+            if i not in self._iter_to_tab:
+                detailed_progress_widget = DetailedProgress(self.state_colors, self)
+                detailed_progress_widget.clicked.connect(self.show_selection)
+                detailed_progress_widget.show()
+                self._iter_to_tab[i] = self.iterations.addTab(detailed_progress_widget,
+                                                              "Realizations for iteration {}".format(i))
+            self.iterations.widget(self._iter_to_tab[i]).set_progress(progress[i], i)
 
         self.update_single_view()
         self.update()
@@ -7,6 +7,7 @@ from ert_gui.ertwidgets.models.targetcasemodel import TargetCaseModel
 from ert_gui.ertwidgets.stringbox import StringBox
 from ert_shared.ide.keywords.definitions import RangeStringArgument, ProperNameFormatArgument
 from ert_gui.simulation import SimulationConfigPanel
+from ert_gui.simulation.straggler_timeout_spinner import StragglerTimeoutSpinner
 from ert_shared.models import IteratedEnsembleSmoother
 
 
@@ -51,6 +52,9 @@ class IteratedEnsembleSmootherPanel(SimulationConfigPanel):
         self._active_realizations_field.setValidator(RangeStringArgument(getRealizationCount()))
         layout.addRow("Active realizations", self._active_realizations_field)
 
+        self._straggler_timeout_spinner = StragglerTimeoutSpinner()
+        layout.addRow("Straggler timeout:", self._straggler_timeout_spinner)
+
 
         self._iterated_target_case_format_field.getValidationSupport().validationChanged.connect(self.simulationConfigurationChanged)
         self._active_realizations_field.getValidationSupport().validationChanged.connect(self.simulationConfigurationChanged)
@@ -65,6 +69,7 @@ class IteratedEnsembleSmootherPanel(SimulationConfigPanel):
     def getSimulationArguments(self):
         arguments = {"active_realizations": self._active_realizations_model.getActiveRealizationsMask(),
                      "target_case": self._iterated_target_case_format_model.getValue(),
-                     "analysis_module": self._analysis_module_selector.getSelectedAnalysisModuleName()
+                     "analysis_module": self._analysis_module_selector.getSelectedAnalysisModuleName(),
+                     "straggler_timeout": self._straggler_timeout_spinner.getStragglerTimeout()
                      }
         return arguments
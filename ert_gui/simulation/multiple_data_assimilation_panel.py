@@ -13,7 +13,7 @@
 #
 #  See the GNU General Public License at <http://www.gnu.org/licenses/gpl.html>
 #  for more details.
-from qtpy.QtWidgets import QFormLayout, QLabel
+from qtpy.QtWidgets import QCheckBox, QFormLayout, QLabel
 
 from ert_gui.ertwidgets import addHelpToWidget, CaseSelector, ActiveLabel, AnalysisModuleSelector
 from ert_gui.ertwidgets.models.activerealizationsmodel import ActiveRealizationsModel
@@ -21,8 +21,10 @@ from ert_gui.ertwidgets.models.ertmodel import getRealizationCount, getRunPath
 from ert_gui.ertwidgets.models.targetcasemodel import TargetCaseModel
 from ert_gui.ertwidgets.models.valuemodel import ValueModel
 from ert_gui.ertwidgets.stringbox import StringBox
+from ert_shared.feature_toggling import FeatureToggling
 from ert_shared.ide.keywords.definitions import NumberListStringArgument, RangeStringArgument, ProperNameFormatArgument
 from ert_gui.simulation import SimulationConfigPanel
+from ert_gui.simulation.straggler_timeout_spinner import StragglerTimeoutSpinner
 from ert_shared.models import MultipleDataAssimilation
 
 
@@ -60,6 +62,16 @@ class MultipleDataAssimilationPanel(SimulationConfigPanel):
         self._active_realizations_field.setValidator(RangeStringArgument(getRealizationCount()))
         layout.addRow("Active realizations", self._active_realizations_field)
 
+        self._pipelined_box = QCheckBox("Create next runpaths during update")
+        self._pipelined_box.setToolTip("Create the runpaths of the next iteration in the background "
+                                       "while the results of the previous iteration are being stored. "
+                                       "Only available with the new storage, since the results are "
+                                       "not stored otherwise.")
+        self._pipelined_box.setEnabled(FeatureToggling.is_enabled("new-storage"))
+        layout.addRow("Pipelined:", self._pipelined_box)
+
+        self._straggler_timeout_spinner = StragglerTimeoutSpinner()
+        layout.addRow("Straggler timeout:", self._straggler_timeout_spinner)
 
         self._target_case_format_field.getValidationSupport().validationChanged.connect(self.simulationConfigurationChanged)
         self._active_realizations_field.getValidationSupport().validationChanged.connect(self.simulationConfigurationChanged)
@@ -101,7 +113,9 @@ class MultipleDataAssimilationPanel(SimulationConfigPanel):
         arguments = {"active_realizations": self._active_realizations_model.getActiveRealizationsMask(),
                      "target_case": self._target_case_format_model.getValue(),
                      "analysis_module": self._analysis_module_selector.getSelectedAnalysisModuleName(),
-                     "weights": self.weights
+                     "weights": self.weights,
+                     "pipelined": self._pipelined_box.isChecked(),
+                     "straggler_timeout": self._straggler_timeout_spinner.getStragglerTimeout()
                      }
         return arguments
 
@@ -18,6 +18,7 @@ from res.job_queue import JobStatusType
 
 class RunDialog(QDialog):
     simulation_done = Signal(bool, str)
+    _state_changed = Signal()
 
     def __init__(self, config_file, run_model, simulation_arguments, storage_client, parent=None):
         QDialog.__init__(self, parent)
@@ -40,7 +41,8 @@ class RunDialog(QDialog):
         self.simulations_tracker = create_tracker(
             run_model, qtimer_cls=QTimer,
             event_handler=self._on_tracker_event,
-            num_realizations=self._simulations_argments["active_realizations"].count())
+            num_realizations=self._simulations_argments["active_realizations"].count(),
+            state_change_signal=self._state_changed)
 
         states = self.simulations_tracker.get_states()
         self.state_colors = {state.name: state.color for state in states}
@@ -153,12 +155,15 @@ class RunDialog(QDialog):
             if self.killJobs() != QMessageBox.Yes:
                 QCloseEvent.ignore()
 
-    def startSimulation(self):
+    def startSimulation(self, fast_restart=False):
         self._run_model.reset()
         self.simulations_tracker.reset()
 
         def run():
-            self._run_model.startSimulations( self._simulations_argments )
+            if fast_restart:
+                self._run_model.restartFailedRealizations( self._simulations_argments )
+            else:
+                self._run_model.startSimulations( self._simulations_argments )
 
         simulation_thread = Thread(name="ert_gui_simulation_thread")
         simulation_thread.setDaemon(True)
@@ -213,9 +218,10 @@ class RunDialog(QDialog):
                         state.name, state.count, state.total_count)
 
         if isinstance(event, DetailedEvent):
-            if not self.progress.get_indeterminate():
-                self.detailed_progress.set_progress(event.details,
-                                                    event.iteration)
+            # Detailed events only carry the realizations that changed, so
+            # they are all applied even while the progress is indeterminate.
+            self.detailed_progress.set_progress(event.details,
+                                                event.iteration)
 
         if isinstance(event, EndEvent):
             self.simulation_done.emit(event.failed, event.failed_msg)
@@ -252,9 +258,13 @@ class RunDialog(QDialog):
 
     def restart_failed_realizations(self):
 
+        fast_restart = self._run_model.support_fast_restart
         msg = QMessageBox(self)
         msg.setIcon(QMessageBox.Information)
-        msg.setText("Note that workflows will only be executed on the restarted realizations and that this might have unexpected consequences.")
+        if fast_restart:
+            msg.setText("The failed realizations will be run again in their existing runpaths. Note that workflows will not be executed for the restarted realizations.")
+        else:
+            msg.setText("Note that workflows will only be executed on the restarted realizations and that this might have unexpected consequences.")
         msg.setWindowTitle("Restart Failed Realizations")
         msg.setStandardButtons(QMessageBox.Ok | QMessageBox.Cancel)
         result = msg.exec_()
@@ -267,7 +277,7 @@ class RunDialog(QDialog):
             self._simulations_argments['active_realizations'] = active_realizations
             self._simulations_argments['prev_successful_realizations'] = self._simulations_argments.get('prev_successful_realizations', 0)
             self._simulations_argments['prev_successful_realizations'] += self.count_successful_realizations()
-            self.startSimulation()
+            self.startSimulation(fast_restart=fast_restart)
 
 
 
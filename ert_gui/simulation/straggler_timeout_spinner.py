@@ -0,0 +1,26 @@
+from qtpy.QtWidgets import QSpinBox
+
+
+class StragglerTimeoutSpinner(QSpinBox):
+    """Seconds to wait for the remaining realizations once MIN_REALIZATIONS
+    have succeeded. The lowest value disables the timeout."""
+
+    MAXIMUM = 7 * 24 * 60 * 60
+
+    def __init__(self):
+        QSpinBox.__init__(self)
+        self.setMinimum(0)
+        self.setMaximum(StragglerTimeoutSpinner.MAXIMUM)
+        self.setSuffix(" s")
+        self.setSpecialValueText("Disabled")
+        self.setToolTip(
+            "Kill the realizations still running this many seconds after "
+            "MIN_REALIZATIONS realizations have succeeded, and continue "
+            "without them. Not used if STOP_LONG_RUNNING is set."
+        )
+
+    def getStragglerTimeout(self):
+        """@rtype: int or None"""
+        if self.value() == self.minimum():
+            return None
+        return self.value()
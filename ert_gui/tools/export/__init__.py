@@ -1,5 +1,3 @@
-from .export_model import ExportModel
-from .export_keyword_model import ExportKeywordModel
 from .export_panel import ExportPanel
 from .exporter import Exporter
 from .export_tool import ExportTool
@@ -19,7 +19,8 @@ from ert_gui.ertwidgets import resourceIcon
 from ert_gui.ertwidgets.closabledialog import ClosableDialog
 from ert_gui.ertwidgets.models.ertmodel import getCurrentCaseName
 from ert_gui.tools import Tool
-from ert_gui.tools.export import ExportPanel, Exporter, ExportKeywordModel
+from ert_gui.tools.export import ExportPanel, Exporter
+from ert_shared.export import ExportKeywordModel
 
 
 class ExportTool(Tool):
@@ -33,7 +34,7 @@ class ExportTool(Tool):
     def trigger(self):
         if self.__export_widget is None:
             self.__export_widget = ref(ExportPanel(self.parent()))
-            self.__exporter = Exporter()
+            self.__exporter = Exporter(self.parent())
             self.__export_widget().runExport.connect(self.__exporter.runExport)
 
         self.__export_widget().setSelectedCase(getCurrentCaseName())
@@ -13,67 +13,57 @@
 #
 #  See the GNU General Public License at <http://www.gnu.org/licenses/gpl.html>
 #  for more details.
-import os
 import sys
 
-from qtpy.QtCore import QDir
-from qtpy.QtWidgets import QMessageBox
+from qtpy.QtCore import Qt, QTimer
+from qtpy.QtWidgets import QMessageBox, QProgressDialog
 
-from res.enkf import EnkfFieldFileFormatEnum
-from ert_gui.tools.export import ExportModel, ExportKeywordModel
+from ert_shared.export import ExportModel
 
 
 class Exporter():
-    def __init__(self):
-        self.__export_keyword_model = ExportKeywordModel()
+    PROGRESS_INTERVAL_MS = 100
+
+    def __init__(self, parent=None):
+        self.__export_model = ExportModel()
+        self.__parent = parent
+        self.__export = None
+        self.__progress = None
+        self.__timer = None
 
     def runExport(self, values):
+        """Starts the export in the background, showing its progress in a
+        dialog where it can be cancelled"""
         keyword = values["keyword"]
-        file_name = self.createExportFileNameMask(keyword, values["selected_case"], values["report_step"], values["path"])
+        file_name = self.__export_model.exportPath(keyword, values["selected_case"], values["report_step"], values["path"])
 
-        if self.__export_keyword_model.isFieldKw(keyword):
-            self.exportField(keyword, file_name, values["iactive"], values["file_type_key"], values["report_step"], values["selected_case"])
-        elif self.__export_keyword_model.isGenKw(keyword):
-            self.exportGenKw(keyword, file_name, values["iactive"], values["file_type_key"], values["report_step"], values["selected_case"])
-        elif self.__export_keyword_model.isGenParamKw(keyword) or self.__export_keyword_model.isGenDataKw(keyword):
-            self.exportGenData(keyword, file_name, values["iactive"], values["file_type_key"], values["report_step"], values["selected_case"])
-        else:
+        export = self.__export_model.createExport(keyword, file_name, values["iactive"], values["file_type_key"], values["report_step"], values["selected_case"])
+        if export is None:
             sys.stderr.write('** WARNING: Cannot export unknown keyword type "%s".\n' % keyword)
+            return
 
-    def exportField(self, keyword, file_name, iactive, file_type_key, report_step, selected_case):
-        if file_type_key == "Eclipse GRDECL":
-            file_type = EnkfFieldFileFormatEnum.ECL_GRDECL_FILE
-        else:
-            file_type = EnkfFieldFileFormatEnum.RMS_ROFF_FILE
-
-        result = ExportModel().exportField(keyword, file_name, iactive, file_type, report_step, selected_case)
-        if not result:
-            QMessageBox.warning(self, "Warning", '''Something did not work!''', QMessageBox.Ok)
-
-    def exportGenData(self, keyword, file_name, iactive, file_type_key, report_step, selected_case):
-        ExportModel().exportGenData(keyword, file_name, iactive, file_type_key, report_step, selected_case)
-
-    def exportGenKw(self, keyword, file_name, iactive, file_type_key, report_step, selected_case):
-        ExportModel().exportGenKw(keyword, file_name, iactive, file_type_key, report_step, selected_case)
-
-    def createExportFileNameMask(self, keyword, current_case, report_step, path):
-        impl_type = None
+        _, total = export.progress()
+        self.__progress = QProgressDialog("Exporting %s..." % keyword, "Cancel", 0, total, self.__parent)
+        self.__progress.setWindowModality(Qt.WindowModal)
+        self.__progress.canceled.connect(export.cancel)
 
-        if self.__export_keyword_model.isFieldKw(keyword):
-            impl_type = self.__export_keyword_model.getImplementationType(keyword)
-        elif self.__export_keyword_model.isGenDataKw(keyword):
-            impl_type = "Gen_Data"
-        elif self.__export_keyword_model.isGenKw(keyword):
-            impl_type = "Gen_Kw"
-        elif self.__export_keyword_model.isGenParamKw(keyword):
-            impl_type = "Gen_Param"
+        self.__timer = QTimer()
+        self.__timer.timeout.connect(self.__updateProgress)
 
-        path = os.path.join(str(path), str(current_case), str(impl_type), str(keyword))
+        self.__export = export
+        export.start()
+        self.__timer.start(self.PROGRESS_INTERVAL_MS)
 
-        if self.__export_keyword_model.isGenDataKw(keyword):
-            path = path + "_" + str(report_step)
+    def __updateProgress(self):
+        done, _ = self.__export.progress()
+        if not self.__export.isDone():
+            self.__progress.setValue(done)
+            return
 
-        if not QDir(path).exists():
-            os.makedirs(path)
+        self.__timer.stop()
+        self.__progress.reset()
 
-        return path
+        failed = self.__export.failed()
+        if failed:
+            message = "Exporting realization(s) %s failed:\n%s" % (", ".join(str(iens) for iens in sorted(failed)), failed[min(failed)])
+            QMessageBox.warning(self.__parent, "Warning", message, QMessageBox.Ok)
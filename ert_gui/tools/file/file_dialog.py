@@ -1,12 +1,16 @@
-from qtpy.QtCore import QThread, Slot
-from qtpy.QtWidgets import QDialog, QMessageBox, QDialogButtonBox, QVBoxLayout
+from qtpy.QtCore import QThread, Signal, Slot
+from qtpy.QtGui import QPalette
+from qtpy.QtWidgets import QDialog, QMessageBox, QDialogButtonBox, QHBoxLayout, QLineEdit, QPushButton, QVBoxLayout
 
+from ert_gui.ertwidgets import ValidationSupport
 from .file_model import FileModel
 from .file_view import FileView
 from .file_update_worker import FileUpdateWorker
 
 
 class FileDialog(QDialog):
+    find_requested = Signal(object, object)
+
     def __init__(self, file_name, job_name, job_number, realization, iteration, parent=None):
         super(FileDialog, self).__init__(parent)
 
@@ -15,16 +19,17 @@ class FileDialog(QDialog):
 
         self._file_name = file_name
         try:
-            self._file = open(file_name, "r")
-        except OSError as error:
+            self._file = open(file_name, "rb")
+        except (IOError, OSError) as error:
             self._mb = QMessageBox(QMessageBox.Critical, "Error opening file", error.strerror, QMessageBox.Ok, self)
             self._mb.finished.connect(self.accept)
             self._mb.show()
             return
 
-        self._model = FileModel()
+        self._model = FileModel(file_name)
         self._view = FileView()
         self._view.setModel(self._model)
+        self._match = None
 
         self._init_layout()
         self._init_thread()
@@ -35,21 +40,36 @@ class FileDialog(QDialog):
     def _stop_thread(self):
         self._thread.quit()
         self._thread.wait()
+        self._model.close()
 
     def _init_layout(self):
         self.setMinimumWidth(400)
         self.setMinimumHeight(200)
 
+        self._search_text = QLineEdit()
+        self._search_text.setPlaceholderText("Find")
+        self._search_text.textChanged.connect(self._reset_search)
+        self._find = QPushButton("Find next")
+        self._find.setDefault(True)
+        self._find.clicked.connect(self._find_next)
+
+        search_layout = QHBoxLayout()
+        search_layout.addWidget(self._search_text)
+        search_layout.addWidget(self._find)
+
         dialog_buttons = QDialogButtonBox(QDialogButtonBox.Ok)
         self._follow = dialog_buttons.addButton("Follow", QDialogButtonBox.ActionRole)
+        self._end = dialog_buttons.addButton("Go to end", QDialogButtonBox.ActionRole)
         self._copy_all = dialog_buttons.addButton("Copy All", QDialogButtonBox.ActionRole)
         dialog_buttons.accepted.connect(self.accept)
 
         self._follow.setCheckable(True)
         self._follow.toggled.connect(self._view.enable_follow_mode)
+        self._end.clicked.connect(self._view.scroll_to_end)
         self._copy_all.clicked.connect(self._model.copy_all)
 
         layout = QVBoxLayout(self)
+        layout.addLayout(search_layout)
         layout.addWidget(self._view)
         layout.addWidget(dialog_buttons)
 
@@ -58,10 +78,43 @@ class FileDialog(QDialog):
 
         self._worker = FileUpdateWorker(self._file)
         self._worker.moveToThread(self._thread)
-        self._worker.read.connect(self._model.append_text)
+        self._worker.read.connect(self._model.append_lines)
+        self._worker.found.connect(self._show_match)
+        self.find_requested.connect(self._worker.find)
 
         self._thread.started.connect(self._worker.setup)
         self._thread.finished.connect(self._worker.stop)
         self._thread.finished.connect(self._worker.deleteLater)
         self.finished.connect(self._stop_thread)
         self._thread.start()
+
+    @Slot()
+    def _find_next(self):
+        text = self._search_text.text().encode("utf-8")
+        if not text:
+            return
+
+        self._find.setEnabled(False)
+        if self._match is None:
+            offset = self._model.row_offset(self._view.first_visible_row())
+        else:
+            offset = self._match + 1
+        self.find_requested.emit(text, offset)
+
+    @Slot(object)
+    def _show_match(self, offset):
+        self._find.setEnabled(True)
+
+        palette = self._search_text.palette()
+        if offset < 0:
+            palette.setColor(self._search_text.backgroundRole(), ValidationSupport.ERROR_COLOR)
+        else:
+            palette.setColor(self._search_text.backgroundRole(), self.palette().color(QPalette.Base))
+            self._match = offset
+            self._follow.setChecked(False)
+            self._view.scroll_to_row(self._model.row_at(offset))
+        self._search_text.setPalette(palette)
+
+    @Slot()
+    def _reset_search(self):
+        self._match = None
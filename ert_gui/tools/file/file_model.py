@@ -1,48 +1,143 @@
+import mmap
+
+import numpy
 from qtpy.QtCore import Slot, Qt, QAbstractListModel, QModelIndex
 from qtpy.QtGui import QClipboard
 from qtpy.QtWidgets import QApplication
 
 
 class FileModel(QAbstractListModel):
-    def __init__(self, parent=None):
+    """A list model with a row per line of a file, which may be several
+    gigabytes large.
+
+    The file is memory-mapped, and only the offsets of the line endings are
+    kept in memory. These are found by a FileUpdateWorker, which reads the
+    file in a background thread and reports them through append_lines.
+    A row is decoded from the mapping only when it is asked for, which for a
+    view is when it is visible. A last line that is not yet terminated by a
+    newline is shown as a row of its own.
+    """
+
+    def __init__(self, file_name, parent=None):
         super(FileModel, self).__init__(parent)
-        self._rows = []
-        self._new_line = True
+        self._file_name = file_name
+        self._file = None
+        self._map = None
+        self._line_ends = numpy.empty(0, dtype=numpy.int64)
+        self._line_count = 0
+        self._size = 0
+        self._max_line_length = 0
 
-    def rowCount(self, parent):
+    def rowCount(self, parent=QModelIndex()):
         """
         Overloaded Qt function. Return the number of rows in this model.
         :type parent: QModelIndex
         """
-        return len(self._rows)
+        next_row_offset = self.row_offset(self._line_count)
+        return self._row_count(self._line_count, next_row_offset, self._size)
 
     def data(self, index, role=Qt.DisplayRole):
         """
         Overloaded Qt function. Return data for index.
         :type index: QModelIndex
         """
-        if not index.isValid() or index.row() >= len(self._rows):
+        if not index.isValid() or index.row() >= self.rowCount():
             return
 
-        line = self._rows[index.row()]
         if role == Qt.DisplayRole:
-            return line
+            return self.line(index.row())
+
+    def line(self, row):
+        """The text of @row, without the line ending"""
+        start = self.row_offset(row)
+        end = self._line_ends[row] if row < self._line_count else self._size
+        text = self._map[start:end].decode("utf-8", "replace")
+        return text[:-1] if text.endswith("\r") else text
 
-    @Slot(str)
-    def append_text(self, text):
-        if not self._new_line:
-            text = self._rows[-1] + text
-        self._new_line = text[-2] == "\n"
+    def row_offset(self, row):
+        """The offset in the file of the first byte of @row"""
+        return int(self._line_ends[row - 1]) + 1 if row > 0 else 0
 
-        rows = text.splitlines(False)
-        first = len(self._rows)
-        last = first + len(rows)
+    def row_at(self, offset):
+        """The row containing the byte at @offset in the file"""
+        row = int(numpy.searchsorted(self._line_ends[: self._line_count], offset))
+        return min(row, max(0, self.rowCount() - 1))
 
-        self.beginInsertRows(QModelIndex(), first, last)
-        self._rows.extend(rows)
-        self.endInsertRows()
+    def max_line_length(self):
+        """The length in bytes of the longest line"""
+        return self._max_line_length
+
+    @Slot(object, object)
+    def append_lines(self, line_ends, size):
+        """Extends the model with the first @size bytes of the file, where
+        @line_ends are the offsets of the newlines added since the last
+        call."""
+        self._map_file(size)
+
+        first = self.rowCount()
+        if first > self._line_count:
+            # The unterminated last line has grown, or has been terminated
+            last_line = self.index(first - 1, 0)
+            self.dataChanged.emit(last_line, last_line)
+
+        line_count = self._line_count + len(line_ends)
+        if len(line_ends) > 0:
+            next_row_offset = int(line_ends[-1]) + 1
+        else:
+            next_row_offset = self.row_offset(self._line_count)
+        last = self._row_count(line_count, next_row_offset, size) - 1
+        if last >= first:
+            self.beginInsertRows(QModelIndex(), first, last)
+        self._add_line_ends(line_ends, size)
+        if last >= first:
+            self.endInsertRows()
 
     @Slot()
     def copy_all(self):
         """Copy the entire document into clipboard"""
-        QApplication.clipboard().setText("\n".join(self._rows), QClipboard.Clipboard)
+        text = self._map[: self._size].decode("utf-8", "replace") if self._map else ""
+        QApplication.clipboard().setText(text, QClipboard.Clipboard)
+
+    @Slot()
+    def close(self):
+        if self._map is not None:
+            self._map.close()
+            self._map = None
+        if self._file is not None:
+            self._file.close()
+            self._file = None
+
+    @staticmethod
+    def _row_count(line_count, next_row_offset, size):
+        # An unterminated last line is a row of its own
+        return line_count + 1 if size > next_row_offset else line_count
+
+    def _map_file(self, size):
+        if size == 0 or (self._map is not None and len(self._map) >= size):
+            return
+        if self._file is None:
+            self._file = open(self._file_name, "rb")
+        if self._map is not None:
+            self._map.close()
+        self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+
+    def _add_line_ends(self, line_ends, size):
+        line_count = self._line_count + len(line_ends)
+        if line_count > len(self._line_ends):
+            line_ends_capacity = numpy.empty(
+                max(line_count, 2 * len(self._line_ends)), dtype=numpy.int64
+            )
+            line_ends_capacity[: self._line_count] = self._line_ends[: self._line_count]
+            self._line_ends = line_ends_capacity
+        self._line_ends[self._line_count : line_count] = line_ends
+
+        start = self.row_offset(self._line_count)
+        if len(line_ends) > 0:
+            starts = numpy.concatenate(([start], line_ends[:-1] + 1))
+            longest = int(numpy.max(line_ends - starts))
+            self._max_line_length = max(self._max_line_length, longest)
+            start = int(line_ends[-1]) + 1
+        self._max_line_length = max(self._max_line_length, size - start)
+
+        self._line_count = line_count
+        self._size = size
@@ -1,37 +1,138 @@
-from qtpy.QtCore import Signal, Slot, QObject, QTimer
+import os
+
+import numpy
+from qtpy.QtCore import Signal, Slot, QObject, QTimer, QFileSystemWatcher
+
+NETWORK_FILE_SYSTEMS = ("nfs", "nfs4", "cifs", "smbfs", "smb3", "lustre", "gpfs", "beegfs", "fuse.sshfs", "9p")
+
+
+def file_system_type(path, mounts="/proc/mounts"):
+    """The type of the file system @path is on, as listed in @mounts, or
+    None if it can not be determined"""
+    try:
+        with open(mounts) as mounts_file:
+            entries = [line.split() for line in mounts_file]
+    except (IOError, OSError):
+        return None
+
+    path = os.path.realpath(path)
+    best_match, fs_type = "", None
+    for entry in entries:
+        if len(entry) < 3:
+            continue
+        mount_point = entry[1].replace("\\040", " ")
+        prefix = mount_point.rstrip("/") + "/"
+        if (path == mount_point or path.startswith(prefix)) and len(mount_point) >= len(best_match):
+            best_match, fs_type = mount_point, entry[2]
+    return fs_type
 
 
 class FileUpdateWorker(QObject):
-    POLL_TIMER_MS = 1000
-    POLL_BUFFER_SIZE = 2**16  # 16KiB
-    INIT_BUFFER_SIZE = 2**20  #  1MiB
+    """Reads a file in blocks, and reports the offsets of the newlines in it
+    to a FileModel, which maps the file itself. The file is read a block per
+    event loop iteration until the end is reached. As only newline offsets
+    are sent, the memory usage does not grow with the length of the lines.
+
+    At the end of the file, the worker waits for the file to change, using
+    QFileSystemWatcher (inotify, kqueue, ...), and then reads everything
+    appended to it. The worker is idle as long as the file is unchanged.
+    File change notifications are not delivered for files on network file
+    systems, such as NFS, so these files are polled instead. The poll
+    interval doubles, up to MAX_POLL_TIMER_MS, for every poll that finds no
+    new data, and is reset when there is.
+
+    The worker can also search the file, see find.
+    """
+    MIN_POLL_TIMER_MS = 100
+    MAX_POLL_TIMER_MS = 5000
+    WATCH_DELAY_MS = 50  # Collects bursts of writes into one read
+    READ_BUFFER_SIZE = 2**24  # 16MiB
 
-    read = Signal(str)
+    # Offsets and sizes are sent as object, as they do not fit in a Qt int
+    # for files above 2GiB
+    read = Signal(object, object)
+    found = Signal(object)
 
     def __init__(self, file, parent=None):
         super(FileUpdateWorker, self).__init__(parent)
         self._file = file
+        self._size = 0
         self._timer = None
+        self._watcher = None
+        self._poll_interval = self.MIN_POLL_TIMER_MS
 
     @Slot()
     def stop(self):
         self._file.close()
         self._timer.stop()
+        if self._watcher is not None:
+            self._watcher.fileChanged.disconnect(self._file_changed)
 
     @Slot()
     def setup(self):
-        text = self._file.read(self.INIT_BUFFER_SIZE)
-        self._send_text(text)
-
         self._timer = QTimer()
-        self._timer.timeout.connect(self._poll_file)
-        self._timer.start(self.POLL_TIMER_MS)
+        self._timer.setSingleShot(True)
+        self._timer.timeout.connect(self._read_file)
+
+        if file_system_type(self._file.name) not in NETWORK_FILE_SYSTEMS:
+            watcher = QFileSystemWatcher()
+            if watcher.addPath(self._file.name):
+                self._watcher = watcher
+                self._watcher.fileChanged.connect(self._file_changed)
+
+        self._timer.start(0)
+
+    def is_watching(self):
+        """Whether the file is watched for changes, rather than polled"""
+        return self._watcher is not None
+
+    @Slot(object, object)
+    def find(self, text, offset):
+        """Searches for the bytes @text from @offset, wrapping around at the
+        end of the file, and emits the offset of the first match, or -1. The
+        file is scanned a block at a time, so the search does not load the
+        file into memory."""
+        match = self._find(text, offset, self._size)
+        if match < 0:
+            match = self._find(text, 0, min(offset + len(text) - 1, self._size))
+        self.found.emit(match)
+
+    @Slot(str)
+    def _file_changed(self, _path):
+        if not self._timer.isActive():
+            self._timer.start(self.WATCH_DELAY_MS)
 
     @Slot()
-    def _poll_file(self):
-        text = self._file.read(self.POLL_BUFFER_SIZE)
-        self._send_text(text)
+    def _read_file(self):
+        self._file.seek(self._size)
+        data = self._file.read(self.READ_BUFFER_SIZE)
+        if len(data) > 0:
+            newlines = numpy.flatnonzero(numpy.frombuffer(data, dtype=numpy.uint8) == ord("\n"))
+            self.read.emit(newlines + self._size, self._size + len(data))
+            self._size += len(data)
+
+        if len(data) == self.READ_BUFFER_SIZE:
+            # Catch up without waiting, but let other events through
+            self._timer.start(0)
+        elif self._watcher is None:
+            if len(data) > 0:
+                self._poll_interval = self.MIN_POLL_TIMER_MS
+            else:
+                self._poll_interval = min(2 * self._poll_interval, self.MAX_POLL_TIMER_MS)
+            self._timer.start(self._poll_interval)
 
-    def _send_text(self, text):
-        if len(text) > 0:
-            self.read.emit(text)
+    def _find(self, text, start, end):
+        """Offset of the first occurrence of @text in [@start, @end) of the
+        file, or -1. Consecutive blocks overlap by len(text) - 1 bytes, so
+        matches spanning two blocks are found."""
+        overlap = max(len(text) - 1, 0)
+        while start + len(text) <= end:
+            self._file.seek(start)
+            block = self._file.read(min(self.READ_BUFFER_SIZE, end - start))
+            index = block.find(text)
+            if index >= 0:
+                return start + index
+            if len(block) < len(text) or start + len(block) >= end:
+                break
+            start += len(block) - overlap
+        return -1
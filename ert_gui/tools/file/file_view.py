@@ -1,5 +1,3 @@
-from bisect import bisect_left, bisect_right
-
 from builtins import range
 
 from qtpy.QtCore import QModelIndex, QPoint, QRect, QSize, Slot
@@ -8,12 +6,27 @@ from qtpy.QtWidgets import QAbstractItemView, QStyle, QStyleOptionViewItem
 
 
 class FileView(QAbstractItemView):
+    """A view of a FileModel. The lines are shown in a monospace font, so
+    every row has the same height and the size of the document follows from
+    the number of rows and the length of the longest line. Only the visible
+    rows are ever asked for, so large files are cheap to show and to scroll
+    through.
+
+    The size of the document and the offsets into it are in pixels, and
+    can be larger than the int of the Qt scroll bars and rectangles. The
+    range of a scroll bar is then clamped to MAX_SCROLL_RANGE, and its
+    values are mapped proportionally to offsets in the document."""
+
+    MAX_SCROLL_RANGE = 2 ** 31 - 1
+
     def __init__(self, parent=None):
         super(FileView, self).__init__(parent)
         self.setSelectionMode(self.NoSelection)
-        self._line_offsets = [0]
-        self._line_sizes = []
-        self._size = QSize()
+        self._row_count = 0
+        self._row_height = None
+        self._margin = 0
+        self._width = 0
+        self._height = 0
         self._force_follow = False
 
         self._init_font()
@@ -21,16 +34,17 @@ class FileView(QAbstractItemView):
     def paintEvent(self, event):
         painter = QPainter(self.viewport())
 
-        view_rect = self._translate(event.rect())
-        if view_rect.y() < 0:
+        top = event.rect().top() + self.verticalOffset()
+        if top < 0:
             rect = QRect()
-            rect.setHeight(self.viewport().height() + view_rect.y())
+            rect.setHeight(self.viewport().height() + top)
             rect.setWidth(self.viewport().width())
 
             brush = self.palette().brush(QPalette.Disabled, QPalette.Window)
             painter.fillRect(rect, brush)
 
-        for index in self._intersecting_rows(view_rect):
+        bottom = event.rect().bottom() + self.verticalOffset()
+        for index in self._intersecting_rows(top, bottom):
             option = self._style_option(index)
             delegate = self.itemDelegate(index)
             delegate.paint(painter, option, index)
@@ -51,10 +65,12 @@ class FileView(QAbstractItemView):
 
     def visualRect(self, index):
         """visualRect is a pure virtual member function of QAbstractItemView"""
-        if index.row() < 0 or index.row() >= len(self._line_sizes):
+        if index.row() < 0 or index.row() >= self._row_count:
             return QRect()
-        point = QPoint(-self.horizontalOffset(), self._line_offsets[index.row()] - self.verticalOffset())
-        return QRect(point, self._line_sizes[index.row()])
+        x = max(-self.horizontalOffset(), -self.MAX_SCROLL_RANGE)
+        y = index.row() * self._row_height - self.verticalOffset()
+        point = QPoint(x, min(max(y, -self.MAX_SCROLL_RANGE), self.MAX_SCROLL_RANGE))
+        return QRect(point, QSize(min(self._width, self.MAX_SCROLL_RANGE), self._row_height))
 
     def visualRegionForSelection(self, _selection):
         """visualRegionForSelection is a pure virtual member function of QAbstractItemView"""
@@ -62,14 +78,14 @@ class FileView(QAbstractItemView):
 
     def horizontalOffset(self):
         """horizontalOffset is a pure virtual member function of QAbstractItemView"""
-        return self.horizontalScrollBar().value()
+        return self._offset(self.horizontalScrollBar(), self._horizontal_extent())
 
     def verticalOffset(self):
         """verticalOffset is a pure virtual member function of QAbstractItemView"""
         if self._force_follow:
-            return self._size.height() - self.viewport().height()
+            return self._vertical_extent()
         else:
-            return self.verticalScrollBar().value()
+            return self._offset(self.verticalScrollBar(), self._vertical_extent())
 
     def isIndexHidden(self, _index):
         """isIndexHidden is a pure virtual member function of QAbstractItemView"""
@@ -78,41 +94,60 @@ class FileView(QAbstractItemView):
     @Slot(QModelIndex, int, int)
     def rowsInserted(self, parent, first, last):
         """rowsInserted is an overriden slot of QAbstractItemView"""
-        if first != len(self._line_sizes):
+        if first != self._row_count:
             raise NotImplementedError("FileView can only be appended to")
         model = self.model()
 
-        follow = self._force_follow or self.verticalOffset() == self.verticalScrollBar().maximum()
+        scroll_bar = self.verticalScrollBar()
+        follow = self._force_follow or scroll_bar.value() == scroll_bar.maximum()
 
-        for idx in range(first, last):
-            end = self._size.height()
-            index = model.index(idx, 0)
+        if self._row_height is None:
+            index = model.index(0, 0)
+            size = self.itemDelegate(index).sizeHint(self._style_option(index), index)
+            self._row_height = max(size.height(), 1)
+            self._margin = max(size.width() - self.fontMetrics().width(model.data(index)), 0)
 
-            option = self._style_option(index)
-            delegate = self.itemDelegate(index)
-            size = delegate.sizeHint(option, index)
-
-            self._line_sizes.append(size)
-            self._line_offsets.append(end + size.height())
-            self._size.setWidth(max(size.width(), self._size.width()))
-            self._size.setHeight(end + size.height())
+        self._row_count = last + 1
+        self._width = self._margin + self.fontMetrics().width("M") * model.max_line_length()
+        self._height = self._row_count * self._row_height
         self.updateGeometries()
 
         if follow:
             self.verticalScrollBar().setValue(self.verticalScrollBar().maximum())
         self.viewport().update()
 
+    @Slot(int)
+    def scroll_to_row(self, row):
+        """Scrolls to show @row at the top of the view"""
+        if self._row_height is None:
+            return
+        scroll_bar = self.verticalScrollBar()
+        scroll_bar.setValue(self._scroll_value(scroll_bar, self._vertical_extent(), row * self._row_height))
+
+    @Slot()
+    def scroll_to_end(self):
+        self.verticalScrollBar().setValue(self.verticalScrollBar().maximum())
+        self.viewport().update()
+
+    def first_visible_row(self):
+        return self._resolve_row(QPoint(0, 0))
+
     @Slot()
     def updateGeometries(self):
         """updateGeometries is an overridden slot of QAbstractItemView"""
-        horizontal_max = self._size.width() - self.viewport().width()
+        horizontal_max = min(self._horizontal_extent(), self.MAX_SCROLL_RANGE)
         self.horizontalScrollBar().setRange(0, horizontal_max)
 
         if self._force_follow:
             self.verticalScrollBar().setRange(0, 0)
         else:
-            vertical_max = self._size.height() - self.viewport().height()
+            vertical_extent = self._vertical_extent()
+            vertical_max = min(vertical_extent, self.MAX_SCROLL_RANGE)
             self.verticalScrollBar().setRange(0, vertical_max)
+            if self._row_height is not None:
+                # A step of about a row, also when the values are mapped
+                step = self._row_height * vertical_max // max(vertical_extent, 1)
+                self.verticalScrollBar().setSingleStep(max(step, 1))
 
         QAbstractItemView.updateGeometries(self)
 
@@ -124,18 +159,47 @@ class FileView(QAbstractItemView):
         self.verticalScrollBar().setValue(self.verticalScrollBar().maximum())
         self.viewport().update()
 
-    def _intersecting_rows(self, rect):
-        """Get rows that intersect with rect"""
+    def _horizontal_extent(self):
+        return max(self._width - self.viewport().width(), 0)
+
+    def _vertical_extent(self):
+        """The offset of the end of the document, which can be negative when
+        following a document that is shorter than the view"""
+        if self._force_follow:
+            return self._height - self.viewport().height()
+        return max(self._height - self.viewport().height(), 0)
+
+    @staticmethod
+    def _offset(scroll_bar, extent):
+        """The offset in the document of the value of @scroll_bar, for a
+        document that can be scrolled @extent pixels"""
+        if extent <= scroll_bar.maximum() or scroll_bar.maximum() <= 0:
+            return scroll_bar.value()
+        return scroll_bar.value() * extent // scroll_bar.maximum()
+
+    @staticmethod
+    def _scroll_value(scroll_bar, extent, offset):
+        """The value of @scroll_bar for @offset, see _offset"""
+        if extent <= scroll_bar.maximum() or extent <= 0:
+            return offset
+        return offset * scroll_bar.maximum() // extent
+
+    def _intersecting_rows(self, top, bottom):
+        """Get rows that intersect with the document from @top to @bottom"""
         model = self.model()
-        first = max(0, bisect_left(self._line_offsets, rect.top()) - 1)
-        last = min(len(self._line_sizes), bisect_right(self._line_offsets, rect.bottom()))
+        if self._row_height is None:
+            return []
+        first = max(0, top // self._row_height)
+        last = min(self._row_count, bottom // self._row_height + 1)
 
         return [model.index(row, 0) for row in range(first, last)]
 
     def _resolve_row(self, point):
         """Get row that is at point"""
+        if self._row_height is None:
+            return 0
         y = point.y() + self.verticalOffset()
-        return max(0, bisect_left(self._line_offsets, y) - 1)
+        return min(max(0, y // self._row_height), max(0, self._row_count - 1))
 
     def _init_font(self):
         # There isn't a standard way of getting the system default monospace
@@ -159,7 +223,3 @@ class FileView(QAbstractItemView):
         option.rect = self.visualRect(index)
         option.state = QStyle.State_Enabled
         return option
-
-    def _translate(self, rect):
-        """Translate rect from viewport to document coordinates"""
-        return rect.translated(self.horizontalOffset(), self.verticalOffset())
@@ -1,11 +1,19 @@
+from collections import OrderedDict
+
 from ert_data import loader as loader
 import pandas as pd
 
 
 class PlotApi(object):
+    GEN_KW_CACHE_SIZE = 4  # Cases
 
     def __init__(self, facade):
         self._facade = facade
+        self._gen_kw_data = OrderedDict()
+
+    def clear_cache(self):
+        """ Forgets the data loaded so far, which must be done when the current case or the storage changes."""
+        self._gen_kw_data.clear()
 
     def all_data_type_keys(self):
         """ Returns a list of all the keys except observation keys. For each key a dict is returned with info about
@@ -54,7 +62,7 @@ class PlotApi(object):
         if self._facade.is_summary_key(key):
             data = self._facade.gather_summary_data(case, key).T
         elif self._facade.is_gen_kw_key(key):
-            data = self._facade.gather_gen_kw_data(case, key)
+            data = self._gen_kw_data_for_key(case, key)
             data.columns = pd.Index([0])
         elif self._facade.is_custom_kw_key(key):
             data = self._facade.gather_custom_kw_data(case, key).to_frame(name=0)
@@ -71,12 +79,29 @@ class PlotApi(object):
         except ValueError:
             return data
 
+    def _gen_kw_data_for_key(self, case, key):
+        """ All GEN_KW parameters of a case are loaded in one go the first
+            time one of them is requested, so switching between parameters
+            does not walk the case storage again. Only the most recently
+            plotted cases are kept."""
+        data = self._gen_kw_data.pop(case, None)
+        if data is None:
+            data = self._facade.gather_all_gen_kw_data(case)
+        self._gen_kw_data[case] = data
+        while len(self._gen_kw_data) > PlotApi.GEN_KW_CACHE_SIZE:
+            self._gen_kw_data.popitem(last=False)
+
+        if key in data:
+            return data[[key]].dropna()
+        else:
+            return pd.DataFrame()
+
     def observations_for_obs_keys(self, case, obs_keys):
         """ Returns a pandas DataFrame with the datapoints for a given observation key for a given case. The row index
             is the realization number, and the column index is a multi-index with (obs_key, index/date, obs_index),
             where index/date is used to relate the observation to the data point it relates to, and obs_index is
             the index for the observation itself"""
-        measured_data = pd.DataFrame()
+        measured_data = []
         case_name = case
 
         for key in obs_keys:
@@ -90,11 +115,13 @@ class PlotApi(object):
             # helpful
             self._add_index_range(data)
 
-            data = pd.concat({key: data}, axis=1, names=["obs_key"])
-
-            measured_data = pd.concat([measured_data, data], axis=1)
+            measured_data.append(data)
 
-        data = measured_data.astype(float)
+        if measured_data:
+            data = pd.concat(measured_data, axis=1, keys=obs_keys, names=["obs_key"])
+            data = data.astype(float)
+        else:
+            data = pd.DataFrame()
         expected_keys = ["OBS", "STD"]
         if not isinstance(data, pd.DataFrame):
             raise TypeError(
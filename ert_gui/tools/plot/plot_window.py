@@ -32,6 +32,7 @@ class PlotWindow(QMainWindow):
             self._api = storage_client
         else:
             self._api = PlotApi(ERT.enkf_facade)
+            ERT.ertChanged.connect(self._clearCache)
 
         self.setMinimumWidth(850)
         self.setMinimumHeight(650)
@@ -116,6 +117,9 @@ class PlotWindow(QMainWindow):
 
                 plot_widget.updatePlot(plot_context, case_to_data_map, observations)
 
+    def _clearCache(self):
+        self._api.clear_cache()
+
     def _updateCustomizer(self, plot_widget):
         """ @type plot_widget: PlotWidget """
         key_def = self.getSelectedKey()
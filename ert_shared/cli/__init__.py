@@ -3,3 +3,4 @@ ENSEMBLE_EXPERIMENT_MODE = 'ensemble_experiment'
 ES_MDA_MODE = 'es_mda'
 TEST_RUN_MODE = 'test_run'
 WORKFLOW_MODE = 'workflow'
+EXPORT_MODE = 'export'
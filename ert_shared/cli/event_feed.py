@@ -0,0 +1,121 @@
+import json
+import logging
+import socket
+
+from ert_shared.tracker.events import DetailedEvent, EndEvent, GeneralEvent
+
+logger = logging.getLogger(__name__)
+
+TCP_PREFIX = "tcp://"
+
+
+def open_event_stream(destination):
+    """Opens the stream the event feed is written to. @destination is either
+    a file name or an address on the form tcp://host:port."""
+    if destination.startswith(TCP_PREFIX):
+        host, port = destination[len(TCP_PREFIX) :].rsplit(":", 1)
+        connection = socket.create_connection((host, int(port)))
+        stream = connection.makefile("w")
+        connection.close()  # the stream keeps the socket open
+        return stream
+    return open(destination, "w")
+
+
+class EventFeed(object):
+    """Writes tracker events as newline-delimited JSON records to @out, for
+    external monitoring of a simulation.
+
+    Every GeneralEvent and the EndEvent are written as they come. A
+    DetailedEvent only includes the realizations whose queue status or
+    forward model job statuses changed since the previous DetailedEvent, and
+    is not written at all if nothing changed. Records of DetailedEvents carry
+    the sequence number of the event.
+
+    The forward model job statistics of a GeneralEvent are written as a
+    separate JobStatistics record, whenever they changed.
+
+    If writing fails, e.g. because the consumer of a socket went away, the
+    error is logged and the feed is disabled, so the simulation carries on.
+    """
+
+    def __init__(self, out):
+        self._out = out
+        self._realization_states = {}
+        self._job_statistics = None
+
+    def write(self, event):
+        if self._out is None:
+            return
+
+        try:
+            self._write(event)
+        except (IOError, OSError) as e:
+            logger.warning("Disabling the event feed, writing failed: %s", e)
+            self._out = None
+
+    def _write(self, event):
+        if isinstance(event, GeneralEvent):
+            self._write_record(self._general_record(event))
+            if event.job_statistics and event.job_statistics != self._job_statistics:
+                self._job_statistics = event.job_statistics
+                self._write_record(
+                    {"type": "JobStatistics", "jobs": event.job_statistics}
+                )
+        elif isinstance(event, DetailedEvent):
+            record = self._detailed_record(event)
+            if record["realizations"]:
+                self._write_record(record)
+        elif isinstance(event, EndEvent):
+            self._write_record(
+                {
+                    "type": "EndEvent",
+                    "failed": event.failed,
+                    "failed_msg": event.failed_msg,
+                }
+            )
+
+    def _write_record(self, record):
+        self._out.write(json.dumps(record, sort_keys=True, default=str))
+        self._out.write("\n")
+        self._out.flush()
+
+    @staticmethod
+    def _general_record(event):
+        return {
+            "type": "GeneralEvent",
+            "phase_name": event.phase_name,
+            "current_phase": event.current_phase,
+            "total_phases": event.total_phases,
+            "progress": event.progress,
+            "indeterminate": event.indeterminate,
+            "runtime": event.runtime,
+            "stragglers": {
+                str(queue_index): runtime
+                for queue_index, runtime in event.stragglers.items()
+            },
+            "states": {
+                state.name: {"count": state.count, "total_count": state.total_count}
+                for state in event.sim_states
+            },
+        }
+
+    def _detailed_record(self, event):
+        realizations = {}
+        for iteration, progress in event.details.items():
+            for iens, (jobs, status) in progress.items():
+                state = (str(status), tuple(job.status for job in jobs))
+                if self._realization_states.get((iteration, iens)) == state:
+                    continue
+
+                self._realization_states[(iteration, iens)] = state
+                realizations.setdefault(str(iteration), {})[str(iens)] = {
+                    "status": state[0],
+                    "jobs": [job.dump_data() for job in jobs],
+                }
+
+        return {
+            "type": "DetailedEvent",
+            "iteration": event.iteration,
+            "sequence": event.sequence,
+            "realizations": realizations,
+        }
@@ -0,0 +1,77 @@
+import logging
+
+from ecl.util.util import BoolVector
+from ert_shared import ERT
+from ert_shared.export import ExportModel
+from ert_shared.ide.keywords.definitions import RangeStringArgument
+
+PROGRESS_INTERVAL = 5.0  # seconds
+
+FILE_TYPES = {
+    "grdecl": "Eclipse GRDECL",
+    "roff": "RMS roff",
+    "parameters": "Parameter list",
+    "template": "Template based",
+}
+
+
+def _active_realizations(args):
+    """The realizations to export as a mask, or None if --realizations is
+    outside the ensemble. The syntax is validated by the argument parser,
+    but the ensemble size is only known from the config."""
+    ensemble_size = ERT.enkf_facade.get_ensemble_size()
+    realizations = args.realizations or "0-{}".format(ensemble_size - 1)
+    if RangeStringArgument(ensemble_size).validate(realizations).failed():
+        return None
+    mask = BoolVector(default_value=False, initial_size=ensemble_size)
+    mask.updateActiveMask(realizations)
+    return mask
+
+
+def execute_export(args):
+    """Exports a keyword of a case with one file per realization, with the
+    same ExportModel as the export tool of the GUI. Returns whether all realizations were exported.
+    """
+    iactive = _active_realizations(args)
+    if iactive is None:
+        logging.error(
+            "Realizations {} are not within the ensemble size of {}".format(
+                args.realizations, ERT.enkf_facade.get_ensemble_size()
+            )
+        )
+        return False
+
+    case = args.case or ERT.enkf_facade.get_current_case_name()
+    model = ExportModel()
+    path = model.exportPath(args.keyword, case, args.report_step, args.path)
+    export = model.createExport(
+        args.keyword,
+        path,
+        iactive,
+        FILE_TYPES.get(args.file_type),
+        args.report_step,
+        case,
+        workers=args.workers,
+    )
+    if export is None:
+        logging.error("Keyword {} can not be exported".format(args.keyword))
+        return False
+
+    export.start()
+    try:
+        while not export.wait(PROGRESS_INTERVAL):
+            logging.info("Exported {} of {} realizations".format(*export.progress()))
+    except KeyboardInterrupt:
+        logging.info("Cancelling export...")
+        export.cancel()
+        export.wait()
+
+    failed = export.failed()
+    for iens in sorted(failed):
+        logging.error("Exporting realization {} failed: {}".format(iens, failed[iens]))
+    logging.info(
+        "Exported {} realizations of {} to {}".format(
+            len(export.exported()), args.keyword, path
+        )
+    )
+    return not failed and not export.isCancelled()
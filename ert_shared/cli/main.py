@@ -6,11 +6,14 @@ import threading
 
 from ert_shared import ERT
 from ert_shared import clear_global_state
+from ert_shared.cli.event_feed import EventFeed, open_event_stream
+from ert_shared.cli.export import execute_export
 from ert_shared.cli.model_factory import create_model
 from ert_shared.cli.monitor import Monitor
 from ert_shared.cli.notifier import ErtCliNotifier
 from ert_shared.cli.workflow import execute_workflow
-from ert_shared.cli import WORKFLOW_MODE, ENSEMBLE_SMOOTHER_MODE, ES_MDA_MODE, ENSEMBLE_EXPERIMENT_MODE
+from ert_shared.feature_toggling import FeatureToggling
+from ert_shared.cli import WORKFLOW_MODE, ENSEMBLE_SMOOTHER_MODE, ES_MDA_MODE, ENSEMBLE_EXPERIMENT_MODE, EXPORT_MODE
 from ert_shared.tracker.factory import create_tracker
 from res.enkf import EnKFMain, ResConfig
 
@@ -20,6 +23,13 @@ def _clear_and_exit(args):
     sys.exit(args)
 
 
+def _report_profile(model, args):
+    profiler = model.profiler()
+    print("\n" + profiler.formatSummary())
+    if "timeline" in args and args.timeline:
+        profiler.writeChromeTrace(args.timeline)
+
+
 def run_cli(args):
     logging.basicConfig(level=logging.INFO, format='%(message)s')
     res_config = ResConfig(args.config)
@@ -32,9 +42,20 @@ def run_cli(args):
         execute_workflow(args.name)
         return
 
+    if args.mode == EXPORT_MODE:
+        if not execute_export(args):
+            _clear_and_exit(1)
+        return
+
+    if "pipelined" in args and args.pipelined and not FeatureToggling.is_enabled("new-storage"):
+        # The runpaths are created while the results are stored, which only
+        # the new storage does
+        _clear_and_exit("ERROR: --pipelined requires the new storage")
+
     model, argument = create_model(args)
     if args.disable_monitoring:
         model.startSimulations(argument)
+        _report_profile(model, args)
         if model.hasRunFailed():
             _clear_and_exit(model.getFailMessage())
     else:
@@ -50,23 +71,42 @@ def run_cli(args):
             )
             _clear_and_exit(msg)
 
-        thread = threading.Thread(
-            name="ert_cli_simulation_thread",
-            target=model.startSimulations,
-            args=(argument,)
-        )
-        thread.start()
+        # The event stream is opened first, so a bad destination fails
+        # before any simulation has been started
+        event_stream = None
+        event_feed = None
+        detailed_interval = 0
+        if "event_feed" in args and args.event_feed:
+            try:
+                event_stream = open_event_stream(args.event_feed)
+            except (EnvironmentError, ValueError) as e:
+                _clear_and_exit("ERROR: Can not open event feed {}: {}".format(args.event_feed, e))
+            event_feed = EventFeed(event_stream)
+            detailed_interval = 10
 
-        tracker = create_tracker(model, tick_interval=0, detailed_interval=0)
-        monitor = Monitor(color_always=args.color_always)
+        tracker = create_tracker(model, tick_interval=0, detailed_interval=detailed_interval)
+        monitor = Monitor(color_always=args.color_always, event_feed=event_feed)
 
         try:
-            monitor.monitor(tracker)
-        except (SystemExit, KeyboardInterrupt):
-            print("\nKilling simulations...")
-            model.killAllSimulations()
+            thread = threading.Thread(
+                name="ert_cli_simulation_thread",
+                target=model.startSimulations,
+                args=(argument,)
+            )
+            thread.start()
+
+            try:
+                monitor.monitor(tracker)
+            except (SystemExit, KeyboardInterrupt):
+                print("\nKilling simulations...")
+                model.killAllSimulations()
+
+            thread.join()
+        finally:
+            if event_stream is not None:
+                event_stream.close()
 
-        thread.join()
+        _report_profile(model, args)
 
         if model.hasRunFailed():
             _clear_and_exit(1)  # the monitor has already reported the error message
@@ -22,7 +22,8 @@ class Monitor(object):
     where progress is defined as a combination of fields on @tracker.
 
     Progress is printed to @out. @color_always decides whether or not coloring
-    always should take place, i.e. even if @out does not support it.
+    always should take place, i.e. even if @out does not support it. If an
+    @event_feed is given, every event is also written to it.
     """
     dot = "■ "
     empty_bar_char = " "
@@ -31,8 +32,9 @@ class Monitor(object):
 
     _colorize = _ansi_color
 
-    def __init__(self, out=sys.stdout, color_always=False):
+    def __init__(self, out=sys.stdout, color_always=False, event_feed=None):
         self._out = out
+        self._event_feed = event_feed
 
         # If out is not (like) a tty, disable colors.
         if not out.isatty() and not color_always:
@@ -49,6 +51,8 @@ class Monitor(object):
 
     def monitor(self, tracker):
         for event in tracker.track():
+            if self._event_feed is not None:
+                self._event_feed.write(event)
             if isinstance(event, GeneralEvent):
                 self._print_progress(event)
             if isinstance(event, EndEvent):
@@ -95,6 +99,12 @@ class Monitor(object):
         legends = self._get_legends(event.sim_states)
         for state in event.sim_states:
             statuses += "    {}\n".format(legends[state])
+        if event.stragglers:
+            stragglers = self._colorize(
+                "{} straggling jobs".format(len(event.stragglers)),
+                fg=SimulationStateStatus.COLOR_RUNNING)
+            statuses += "\n    {} running much longer than the completed" \
+                        " ones\n".format(stragglers)
 
         suffix = """{runtime}
 
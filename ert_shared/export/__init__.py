@@ -0,0 +1,3 @@
+from .export_keyword_model import ExportKeywordModel
+from .parallel_export import ParallelExport
+from .export_model import ExportModel
@@ -0,0 +1,215 @@
+#  Copyright (C) 2011  Equinor ASA, Norway.
+#
+#  The file 'export_model.py' is part of ERT - Ensemble based Reservoir Tool.
+#
+#  ERT is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  ERT is distributed in the hope that it will be useful, but WITHOUT ANY
+#  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+#  FITNESS FOR A PARTICULAR PURPOSE.
+#
+#  See the GNU General Public License at <http://www.gnu.org/licenses/gpl.html>
+#  for more details.
+
+from __future__ import print_function
+import os.path
+import threading
+from res.enkf import EnkfConfigNode, EnkfNode, EnkfFieldFileFormatEnum, ErtImplType
+from res.enkf import GenKw, GenDataFileType, GenData, NodeId
+from ert_shared import ERT
+from ert_shared.export.export_keyword_model import ExportKeywordModel
+from ert_shared.export.parallel_export import ParallelExport
+
+
+class ExportModel(object):
+    """Exports the realizations of a keyword of a case to files, one file
+    per realization. The create*Export functions return a ParallelExport,
+    which exports the realizations on a pool of threads when started. The
+    export* functions run the export and wait for it to finish.
+
+    An enkf_fs is not safe to read from several threads, so the exports of
+    a model load the realizations of a case one at a time, under the lock
+    of the case, and only write them to file in parallel."""
+
+    def __init__(self):
+        super(ExportModel, self).__init__()
+        self.__export_keyword_model = ExportKeywordModel()
+        self._case_locks = {}
+        self._case_locks_lock = threading.Lock()
+
+    def createExport(self, keyword, path, iactive, file_type_key, report_step, selected_case, workers=None):
+        """
+        Creates the export of @keyword for the keyword type, or returns None
+        if the keyword can not be exported.
+        @type file_type_key: str
+        @rtype: ParallelExport
+        """
+        if self.__export_keyword_model.isFieldKw(keyword):
+            if file_type_key == "RMS roff":
+                file_type = EnkfFieldFileFormatEnum.RMS_ROFF_FILE
+            else:
+                file_type = EnkfFieldFileFormatEnum.ECL_GRDECL_FILE
+            return self.createFieldExport(keyword, path, iactive, file_type, report_step, selected_case, workers)
+        elif self.__export_keyword_model.isGenKw(keyword):
+            return self.createGenKwExport(keyword, path, iactive, file_type_key, report_step, selected_case, workers)
+        elif self.__export_keyword_model.isGenParamKw(keyword) or self.__export_keyword_model.isGenDataKw(keyword):
+            return self.createGenDataExport(keyword, path, iactive, file_type_key, report_step, selected_case, workers)
+        return None
+
+    def exportPath(self, keyword, current_case, report_step, path):
+        """Creates and returns the directory the files of @keyword are
+        exported to"""
+        impl_type = None
+
+        if self.__export_keyword_model.isFieldKw(keyword):
+            impl_type = self.__export_keyword_model.getImplementationType(keyword)
+        elif self.__export_keyword_model.isGenDataKw(keyword):
+            impl_type = "Gen_Data"
+        elif self.__export_keyword_model.isGenKw(keyword):
+            impl_type = "Gen_Kw"
+        elif self.__export_keyword_model.isGenParamKw(keyword):
+            impl_type = "Gen_Param"
+
+        path = os.path.join(str(path), str(current_case), str(impl_type), str(keyword))
+
+        if self.__export_keyword_model.isGenDataKw(keyword):
+            path = path + "_" + str(report_step)
+
+        if not os.path.isdir(path):
+            os.makedirs(path)
+
+        return path
+
+    def exportField(self, keyword, path, iactive, file_type, report_step, selected_case):
+        """
+        @type keyword: str
+        @type path: str
+        @type iactive: BoolVector
+        @type file_type: EnkfFieldFileFormatEnum
+        @type report_step: int
+        @type selected_case: str
+        """
+        return self.createFieldExport(keyword, path, iactive, file_type, report_step, selected_case).run()
+
+    def createFieldExport(self, keyword, path, iactive, file_type, report_step, selected_case, workers=None):
+        fs = ERT.ert.getEnkfFsManager().getFileSystem(selected_case)
+        if file_type == EnkfFieldFileFormatEnum.ECL_GRDECL_FILE:
+            extension = ".grdecl"
+        elif file_type == EnkfFieldFileFormatEnum.RMS_ROFF_FILE:
+            extension = ".roff"
+
+        path_fmt = os.path.join(path, keyword + "_%d" + extension)
+        config_node = ERT.ert.ensembleConfig()[keyword]
+        mc = ERT.ert.getModelConfig()
+        init_file = config_node.getInitFile(mc.getRunpathFormat())
+        if init_file:
+            print('Using init file:%s' % init_file)
+
+        fs_lock = self._caseLock(selected_case)
+        nodes = threading.local()
+
+        def export_realization(iens):
+            node = ExportModel._threadNode(nodes, config_node)
+            with fs_lock:
+                if not node.tryLoad(fs, NodeId(report_step, iens)):
+                    return False
+
+            node.export(path_fmt % iens, file_type=file_type, arg=init_file)
+            return True
+
+        return ParallelExport(iactive.createActiveList(), export_realization, workers)
+
+    def exportGenKw(self, keyword, path, iactive, file_type, report_step, selected_case):
+        """
+        @type keyword: str
+        @type path: str
+        @type iactive: BoolVector
+        @type file_type: EnkfFieldFileFormatEnum
+        @type report_step: int
+        @type selected_case: str
+        """
+        return self.createGenKwExport(keyword, path, iactive, file_type, report_step, selected_case).run()
+
+    def createGenKwExport(self, keyword, path, iactive, file_type, report_step, selected_case, workers=None):
+        enkf_config_node = ERT.ert.ensembleConfig().getNode(keyword)
+        assert isinstance(enkf_config_node, EnkfConfigNode)
+        fs = ERT.ert.getEnkfFsManager().getFileSystem(selected_case)
+        fs_lock = self._caseLock(selected_case)
+        nodes = threading.local()
+
+        def export_realization(index):
+            node = ExportModel._threadNode(nodes, enkf_config_node)
+            with fs_lock:
+                if not node.tryLoad(fs, NodeId(report_step, index)):
+                    return False
+
+            gen_kw = GenKw.createCReference(node.valuePointer())
+            filename = str(path + "/" + keyword + "_{0}").format(index)
+            if file_type == "Template based":
+                filename += ".inc"
+                gen_kw.exportTemplate(filename)
+            else:
+                filename += ".txt"
+                gen_kw.exportParameters(filename)
+            return True
+
+        return ParallelExport(ExportModel._activeRealizations(iactive), export_realization, workers)
+
+    def exportGenData(self, keyword, path, iactive, file_type, report_step, selected_case):
+        """
+        @type keyword: str
+        @type path: str
+        @type iactive: BoolVector
+        @type file_type: EnkfFieldFileFormatEnum
+        @type report_step: int
+        @type selected_case: str
+        """
+        return self.createGenDataExport(keyword, path, iactive, file_type, report_step, selected_case).run()
+
+    def createGenDataExport(self, keyword, path, iactive, file_type, report_step, selected_case, workers=None):
+        fs = ERT.ert.getEnkfFsManager().getFileSystem(selected_case)
+        config_node = ERT.ert.ensembleConfig().getNode(keyword)
+        gen_data_config_node = config_node.getDataModelConfig()
+
+        export_type = gen_data_config_node.getOutputFormat()
+        if export_type == GenDataFileType.GEN_DATA_UNDEFINED:
+            export_type = gen_data_config_node.getInputFormat()
+
+        fs_lock = self._caseLock(selected_case)
+        nodes = threading.local()
+
+        def export_realization(index):
+            node = ExportModel._threadNode(nodes, config_node)
+            node_id = NodeId(int(report_step), index)
+
+            with fs_lock:
+                if not node.tryLoad(fs, node_id):
+                    return False
+
+            gen_data = node.asGenData()
+
+            filename = str(path + "/" + keyword + "_{0}").format(index) + ".txt"
+            gen_data.export(filename, export_type, None)
+            return True
+
+        return ParallelExport(ExportModel._activeRealizations(iactive), export_realization, workers)
+
+    def _caseLock(self, case):
+        """The lock serializing the reads from the storage of @case"""
+        with self._case_locks_lock:
+            return self._case_locks.setdefault(case, threading.Lock())
+
+    @staticmethod
+    def _activeRealizations(iactive):
+        return [index for index, active in enumerate(iactive) if active]
+
+    @staticmethod
+    def _threadNode(nodes, config_node):
+        """An EnkfNode for @config_node for the calling thread, as a node
+        holds the data of the realization loaded into it"""
+        if not hasattr(nodes, "node"):
+            nodes.node = EnkfNode(config_node)
+        return nodes.node
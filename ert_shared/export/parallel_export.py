@@ -0,0 +1,120 @@
+import logging
+import threading
+import time
+from multiprocessing import cpu_count
+
+try:
+    from queue import Empty, Queue
+except ImportError:
+    from Queue import Empty, Queue
+
+
+class ParallelExport(object):
+    """Exports the realizations of a keyword on a pool of worker threads,
+    one realization at a time, and tells how far it has come.
+
+    @export_realization is called with the index of a realization, from any
+    of the worker threads, and returns whether there was anything to export
+    for it. It must itself serialize what is not safe to do from several
+    threads at once, such as reading from the same storage. An error
+    exporting one realization is logged, and does not stop the others.
+
+    A cancelled export finishes the realizations being exported, and skips
+    the rest.
+    """
+
+    DEFAULT_WORKERS = min(8, cpu_count())
+
+    def __init__(self, realizations, export_realization, workers=None):
+        self._realizations = list(realizations)
+        self._export_realization = export_realization
+        self._workers = workers or ParallelExport.DEFAULT_WORKERS
+        self._pending = Queue()
+        for iens in self._realizations:
+            self._pending.put(iens)
+
+        self._lock = threading.Lock()
+        self._exported = []
+        self._skipped = []
+        self._failed = {}
+        self._cancelled = threading.Event()
+        self._threads = []
+
+    def start(self):
+        workers = min(self._workers, len(self._realizations))
+        for index in range(workers):
+            thread = threading.Thread(
+                name="ert_export_{}".format(index), target=self._run_worker
+            )
+            thread.daemon = True
+            thread.start()
+            self._threads.append(thread)
+
+    def run(self):
+        """Exports all the realizations, and returns whether all succeeded.
+        @rtype: bool"""
+        self.start()
+        self.wait()
+        return not self._failed and not self.isCancelled()
+
+    def wait(self, timeout=None):
+        """Waits for the export to finish, at most @timeout seconds if given.
+        @rtype: bool"""
+        deadline = None if timeout is None else time.time() + timeout
+        for thread in self._threads:
+            if deadline is None:
+                thread.join()
+            else:
+                thread.join(max(deadline - time.time(), 0))
+        return self.isDone()
+
+    def cancel(self):
+        self._cancelled.set()
+
+    def isCancelled(self):
+        """@rtype: bool"""
+        return self._cancelled.is_set()
+
+    def isDone(self):
+        """@rtype: bool"""
+        return not any(thread.is_alive() for thread in self._threads)
+
+    def progress(self):
+        """The number of realizations done, exported or not, and the total.
+        @rtype: (int, int)"""
+        with self._lock:
+            done = len(self._exported) + len(self._skipped) + len(self._failed)
+        return done, len(self._realizations)
+
+    def exported(self):
+        """The realizations that were exported, in order.
+        @rtype: list of int"""
+        with self._lock:
+            return sorted(self._exported)
+
+    def failed(self):
+        """The error message per realization that failed to export.
+        @rtype: dict of (int, str)"""
+        with self._lock:
+            return dict(self._failed)
+
+    def _run_worker(self):
+        while not self.isCancelled():
+            try:
+                iens = self._pending.get_nowait()
+            except Empty:
+                return
+
+            try:
+                exported = self._export_realization(iens)
+            except Exception as e:
+                logging.exception("Exporting realization {} failed".format(iens))
+                with self._lock:
+                    self._failed[iens] = str(e)
+                continue
+
+            with self._lock:
+                if exported:
+                    self._exported.append(iens)
+                else:
+                    self._skipped.append(iens)
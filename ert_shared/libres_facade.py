@@ -1,3 +1,5 @@
+import logging
+
 from pandas import DataFrame
 from res.analysis.analysis_module import AnalysisModule
 from res.analysis.enums.analysis_module_options_enum import \
@@ -7,12 +9,17 @@ from res.enkf.export import (GenDataCollector, SummaryCollector,
                              CustomKWCollector)
 from res.enkf.plot_data import PlotBlockDataLoader
 
+from ert_data.observation_index import ObservationIndex
+
+logger = logging.getLogger(__name__)
+
 
 class LibresFacade(object):
     """Facade for libres inside ERT."""
 
     def __init__(self, enkf_main):
         self._enkf_main = enkf_main
+        self._observation_index = None
 
     def get_analysis_module_names(self, iterable=False):
         modules = self.get_analysis_modules(iterable)
@@ -46,6 +53,14 @@ class LibresFacade(object):
     def get_observations(self):
         return self._enkf_main.getObservations()
 
+    def get_observation_index(self):
+        """ Observation values and indexes per observation key, resolved
+        once per EnKFMain and independent of case storage.
+        :rtype: ert_data.observation_index.ObservationIndex """
+        if self._observation_index is None:
+            self._observation_index = ObservationIndex(self)
+        return self._observation_index
+
     def get_impl_type_name_for_obs_key(self, key):
         return self._enkf_main.getObservations()[key].getImplementationType().name
 
@@ -126,19 +141,42 @@ class LibresFacade(object):
         else:
             return DataFrame()
 
+    def gather_all_gen_kw_data(self, case, keys=None):
+        """ Loads the GEN_KW parameters for all keys, or only the given keys,
+        of a case in a single pass over the case storage. The row index is
+        the realization number and there is one column per key.
+        :rtype: pandas.DataFrame """
+        return GenKwCollector.loadAllGenKwData(self._enkf_main, case, keys)
+
     def gather_summary_data(self, case, key):
         """ :rtype: pandas.DataFrame """
-        data = SummaryCollector.loadAllSummaryData(self._enkf_main, case, [key])
+        data = self.gather_all_summary_data(case, [key])
         if not data.empty:
-            data = data.reset_index()
+            data = data[key]
 
-            if any(data.duplicated()):
-                print("** Warning: The simulation data contains duplicate "
-                      "timestamps. A possible explanation is that your "
-                      "simulation timestep is less than a second.")
-                data = data.drop_duplicates()
+        return data
 
-            data = data.pivot(index="Date", columns="Realization", values=key)
+    def gather_all_summary_data(self, case, keys=None):
+        """ Loads the summary data for all keys, or only the given keys, of a
+        case in a single pass over the case storage. The data is pivoted once
+        so that the row index is the date and the columns are a
+        (key, realization) multi-index; selecting one key gives the same frame
+        as gather_summary_data.
+        :rtype: pandas.DataFrame """
+        data = SummaryCollector.loadAllSummaryData(self._enkf_main, case, keys)
+        if not data.empty:
+            # Only rows where both the timestamp and all the values are
+            # repeated are dropped; a timestamp repeated with other values
+            # is an error when pivoting, as it was for a single key.
+            duplicated = data.reset_index().duplicated().values
+
+            if duplicated.any():
+                logger.warning("The simulation data contains duplicate "
+                               "timestamps. A possible explanation is that your "
+                               "simulation timestep is less than a second.")
+                data = data[~duplicated]
+
+            data = data.unstack(level="Realization")
 
         return data
 
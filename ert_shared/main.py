@@ -11,6 +11,7 @@ from ert_shared.cli import (
     ENSEMBLE_SMOOTHER_MODE,
     ENSEMBLE_EXPERIMENT_MODE,
     ES_MDA_MODE,
+    EXPORT_MODE,
     TEST_RUN_MODE,
     WORKFLOW_MODE,
 )
@@ -88,6 +89,16 @@ def range_limited_int(user_input):
     raise ArgumentTypeError("Range must be in range 1 - 99")
 
 
+def valid_straggler_timeout(user_input):
+    try:
+        timeout = float(user_input)
+    except ValueError:
+        raise ArgumentTypeError("Must be a number of seconds")
+    if timeout < 0:
+        raise ArgumentTypeError("Must not be negative")
+    return timeout
+
+
 def run_gui_wrapper(args):
     from ert_gui.gert_main import run_gui
 
@@ -257,6 +268,22 @@ def get_ert_parser(parser=None):
         "Assimilation Ensemble Smoother will half the weight applied to the "
         "Observation Errors from one iteration to the next across 4 iterations.",
     )
+    es_mda_parser.add_argument(
+        "--pipelined",
+        action="store_true",
+        default=False,
+        help="Create the runpaths of the next iteration in the background while "
+        "the results of the previous iteration are being stored. Requires the "
+        "new storage.",
+    )
+    es_mda_parser.add_argument(
+        "--straggler-timeout",
+        type=valid_straggler_timeout,
+        help="Kill the realizations still running this many seconds after "
+        "MIN_REALIZATIONS realizations have succeeded, and continue the "
+        "iteration without them. By default all realizations are waited for. "
+        "Not used if STOP_LONG_RUNNING is set in the config.",
+    )
     es_mda_parser.add_argument(
         "--current-case",
         type=valid_name,
@@ -271,14 +298,57 @@ def get_ert_parser(parser=None):
     )
     workflow_parser.add_argument(help="Name of workflow", dest="name")
 
+    export_description = (
+        "Export a keyword of a case to files, one file per realization, "
+        "exporting several realizations in parallel"
+    )
+    export_parser = subparsers.add_parser(
+        EXPORT_MODE, help=export_description, description=export_description
+    )
+    export_parser.add_argument("keyword", help="Name of the keyword to export")
+    export_parser.add_argument(
+        "--case",
+        type=valid_name,
+        help="Name of the case to export from. Default: the current case",
+    )
+    export_parser.add_argument(
+        "--realizations",
+        type=valid_realizations,
+        help="The realizations to export, e.g. '0-9,20'. Default: all",
+    )
+    export_parser.add_argument(
+        "--path",
+        default="export",
+        help="Directory to export to. The files are put in a sub directory "
+        "per case, keyword type and keyword. Default: export",
+    )
+    export_parser.add_argument(
+        "--file-type",
+        choices=["grdecl", "roff", "parameters", "template"],
+        help="File format. grdecl (default) or roff for fields, parameters "
+        "(default) or template for GEN_KW keywords",
+    )
+    export_parser.add_argument(
+        "--report-step",
+        type=int,
+        default=0,
+        help="Report step to export. Default: 0",
+    )
+    export_parser.add_argument(
+        "--workers",
+        type=range_limited_int,
+        default=None,
+        help="Number of realizations exported in parallel",
+    )
+
     # Common arguments/defaults for all non-gui modes
-    for cli_parser in [
+    simulation_parsers = [
         test_run_parser,
         ensemble_experiment_parser,
         ensemble_smoother_parser,
         es_mda_parser,
-        workflow_parser,
-    ]:
+    ]
+    for cli_parser in simulation_parsers + [workflow_parser, export_parser]:
         cli_parser.set_defaults(func=run_cli)
         cli_parser.add_argument(
             "--verbose", action="store_true", help="Show verbose output", default=False
@@ -290,12 +360,27 @@ def get_ert_parser(parser=None):
             + " disabled if the output stream is not a terminal.",
             default=False,
         )
-        cli_parser.add_argument(
+        monitoring_group = cli_parser.add_mutually_exclusive_group()
+        monitoring_group.add_argument(
             "--disable-monitoring",
             action="store_true",
             help="Disable monitoring.",
             default=False,
         )
+        if cli_parser in simulation_parsers:
+            monitoring_group.add_argument(
+                "--event-feed",
+                help="Write progress events as newline-delimited JSON to the given"
+                + " file, or to a socket when given as tcp://host:port. Detailed"
+                + " events only include realizations whose status changed.",
+                default=None,
+            )
+            cli_parser.add_argument(
+                "--timeline",
+                help="Write the time spent in each phase of the run to the given"
+                + " file, in the Chrome trace format.",
+                default=None,
+            )
         cli_parser.add_argument("config", type=valid_file, help=config_help)
 
         FeatureToggling.add_feature_toggling_args(cli_parser)
@@ -1,10 +1,28 @@
+import os
 import time
 import logging
+import threading
+from collections import OrderedDict
+from functools import partial
+try:
+    from queue import Queue
+except ImportError:
+    from Queue import Queue
 from res.job_queue import JobStatusType
 from res.job_queue import ForwardModelStatus
 from res.util import ResLog
 from ecl.util.util import BoolVector
+from res.enkf import EnkfSimulationRunner
+from res.enkf.enums import HookRuntime
 from ert_shared import ERT
+from ert_shared.models.job_queue_runner import JobQueueRunner
+from ert_shared.models.job_queue_watcher import JobQueueWatcher
+from ert_shared.models.job_telemetry import JobTelemetry
+from ert_shared.models.phase_profiler import PhaseProfiler
+from ert_shared.models.runpath_creation import RunpathCreation
+from ert_shared.models.status_file_watcher import StatusFileWatcher
+from ert_shared.models.straggler_stop import StragglerStop
+from ert_shared.tracker.events import PhaseChangeEvent
 
 # A method decorated with the @job_queue decorator implements the following logic:
 #
@@ -32,6 +50,10 @@ class ErtRunError(Exception):
 
 class BaseRunModel(object):
 
+    RUNPATH_POLL_INTERVAL = 0.25
+    # Written to a runpath by the job queue and the job runner
+    STATUS_FILES = ("STATUS", "status.json", "OK", "ERROR")
+
     def __init__(self, queue_config, phase_count=1):
         super(BaseRunModel, self).__init__()
         self._phase = 0
@@ -49,8 +71,31 @@ class BaseRunModel(object):
         self.initial_realizations_mask = []
         self.completed_realizations_mask = []
         self.support_restart = True
+        self.support_fast_restart = False
         self._run_context = None
         self._last_run_iteration = -1
+        self._subscribers = []
+        self._subscriber_lock = threading.Lock()
+        # Held for every access to the job queue, which is read from the
+        # simulation thread, the watchers and the GUI
+        self._queue_lock = threading.RLock()
+        # Serializes the use of EnKFMain while runpaths are created in the
+        # background, see startRunPathCreation
+        self._libres_lock = threading.RLock()
+        self._job_queue_watcher = JobQueueWatcher(lambda: self._job_queue, self.publish, queue_lock=self._queue_lock)
+        self._status_file_watcher = StatusFileWatcher(self.updateDetailedProgress)
+        # The status files are only watched while a simulation runs and
+        # someone is watching the detailed progress, see watchDetailedProgress
+        self._status_watch_lock = threading.Lock()
+        self._detailed_progress_watchers = 0
+        self._simulating = False
+        self._progress_lock = threading.Lock()
+        # The sequence number of the latest change per (iteration, iens),
+        # with the most recently changed last
+        self._progress_sequence = 0
+        self._progress_changes = OrderedDict()
+        self._profiler = PhaseProfiler()
+        self._job_telemetry = JobTelemetry()
         self.reset( )
 
     def ert(self):
@@ -66,9 +111,28 @@ class BaseRunModel(object):
 
 
     def startSimulations(self, arguments):
+        self._startSimulations(arguments, self.runSimulations)
+
+    def restartFailedRealizations(self, arguments):
+        """Runs the realizations in arguments["active_realizations"] again in
+        the runpaths they already have, without the pre and post processing
+        of a full run. The results loaded for the other realizations are
+        kept. Only for models with support_fast_restart."""
+        self._startSimulations(arguments, self.rerunSimulations)
+
+    def _startSimulations(self, arguments, run_simulations):
+        # The profile and the job statistics are of the latest run only
+        self._profiler.reset()
+        self._job_telemetry.reset()
+        self._job_queue_watcher.start()
+        with self._status_watch_lock:
+            self._simulating = True
+            if self._detailed_progress_watchers > 0:
+                self._status_file_watcher.start()
         try:
             self.initial_realizations_mask = arguments["active_realizations"]
-            run_context = self.runSimulations(arguments)
+            with self.span("Simulations", category="run"):
+                run_context = run_simulations(arguments)
             self.updateDetailedProgress()
             self.completed_realizations_mask = run_context.get_mask()
         except ErtRunError as e:
@@ -79,6 +143,12 @@ class BaseRunModel(object):
         except UserWarning as e:
             self._fail_message = str(e)
             self._simulationEnded()
+        finally:
+            with self._status_watch_lock:
+                self._simulating = False
+                self._status_file_watcher.stop()
+            self._job_queue_watcher.stop()
+            self._publishPhaseChange()
 
         self._run_context = None #delete last active run_context to notify fs_manager that storage is not being written to
 
@@ -86,19 +156,158 @@ class BaseRunModel(object):
         raise NotImplementedError("Method must be implemented by inheritors!")
 
 
+    def rerunSimulations(self, arguments):
+        raise NotImplementedError("Method must be implemented by inheritors supporting fast restart!")
+
+
     def create_context(self, arguments):
         raise NotImplementedError("Method must be implemented by inheritors!")
 
 
+    def createRunPath(self, run_context):
+        """Creates the runpaths of the active realizations in @run_context.
+        Where there is other work to overlap with, like the storage
+        extraction between ES MDA iterations, create the runpaths with a
+        RunpathCreation up front and pass it to waitForRunPath."""
+        return self.waitForRunPath(self.startRunPathCreation(run_context))
+
+
+    def prepareRunPath(self, run_context):
+        """Creates the runpaths of @run_context and runs the PRE_SIMULATION
+        workflows. The workflows may change the runpaths, so if there are
+        any, they are run once all the runpaths exist, and None is returned.
+        Otherwise the runpaths are created in the background, and the
+        RunpathCreation is returned, to be passed to runSimpleStep, which
+        submits each realization as soon as its runpath is ready.
+        @rtype: RunpathCreation or None"""
+        if not self.hasPreSimulationWorkflows():
+            return self.startRunPathCreation(run_context)
+
+        self.createRunPath(run_context)
+        self.runWorkflows(HookRuntime.PRE_SIMULATION)
+        return None
+
+
+    def hasPreSimulationWorkflows(self):
+        """ @rtype: bool """
+        return any(hook_workflow.getRunMode() == HookRuntime.PRE_SIMULATION
+                   for hook_workflow in self.ert().getHookManager())
+
+
+    def startRunPathCreation(self, run_context):
+        """Starts creating the runpaths of @run_context in the background.
+        EnKFMain is not thread safe, so until waitForRunPath returns, it may
+        only be used while holding _libres_lock.
+        @rtype: RunpathCreation"""
+        create_runpath = self.ert().getEnkfSimulationRunner().createRunPath
+
+        def profiled_create_runpath(run_context):
+            with self.span("Create runpaths"), self._libres_lock:
+                create_runpath(run_context)
+
+        return RunpathCreation(run_context, profiled_create_runpath)
+
+
+    def waitForRunPath(self, runpath_creation):
+        """Waits for @runpath_creation to finish, reporting the number of
+        realizations with a runpath ready in the phase name as it goes. The
+        phase name is restored afterwards.
+        @rtype: ErtRunContext"""
+        phase_name = self._phase_name
+        active_count = runpath_creation.activeCount()
+        ready_count = None
+        while runpath_creation.wait(self.RUNPATH_POLL_INTERVAL) is None:
+            ready = runpath_creation.readyRealizations()
+            if len(ready) != ready_count:
+                ready_count = len(ready)
+                self.setPhaseName("Creating runpaths: %d of %d realizations ready" % (ready_count, active_count))
+
+        self.setPhaseName(phase_name)
+        return runpath_creation.run_context
+
+
+    def missingRunPaths(self, run_context):
+        """The active realizations in @run_context without a complete runpath.
+        @rtype: list of int"""
+        return [iens for iens in range(len(run_context))
+                if run_context.is_active(iens)
+                and not os.path.isfile(os.path.join(run_context[iens].runpath, RunpathCreation.JOBS_FILE))]
+
+
+    def clearRunPathStatus(self, run_context):
+        """Removes the status files left in the runpaths of the active
+        realizations in @run_context by an earlier run, so they are not
+        taken for the status of the next run of the realizations."""
+        for iens in range(len(run_context)):
+            if not run_context.is_active(iens):
+                continue
+            for status_file in self.STATUS_FILES:
+                try:
+                    os.remove(os.path.join(run_context[iens].runpath, status_file))
+                except OSError:
+                    pass
+
+
+    def runSimpleStep(self, run_context, straggler_timeout=None, runpath_creation=None):
+        """Runs the forward models of @run_context on the job queue and
+        returns the number of successful realizations, see JobQueueRunner.
+        The realizations are submitted as their runpaths are created by
+        @runpath_creation, if given.
+
+        With STOP_LONG_RUNNING in the configuration, the jobs running much
+        longer than the average are killed once MIN_REALIZATIONS have
+        succeeded, as libres does. Otherwise, with a @straggler_timeout the
+        jobs still left that many seconds after MIN_REALIZATIONS have
+        succeeded are killed, see StragglerStop. STOP_LONG_RUNNING takes
+        precedence, as both decide when to give up on the same jobs.
+        @rtype: int"""
+        evaluators = []
+        analysis_config = self.ert().analysisConfig()
+        if analysis_config.get_stop_long_running() and analysis_config.minimum_required_realizations > 0:
+            # As libres does in runSimpleStep
+            evaluators.append(partial(self._job_queue.stop_long_running_jobs,
+                                      analysis_config.minimum_required_realizations))
+            if straggler_timeout is not None:
+                logging.warning("The straggler timeout is not used, as STOP_LONG_RUNNING is set")
+        elif straggler_timeout is not None:
+            evaluators.append(StragglerStop(self, straggler_timeout).check)
+        runner = JobQueueRunner(self.ert(), self._job_queue, self._queue_lock, self._libres_lock, evaluators,
+                                profiler=self._profiler)
+
+        with self.span("Forward models"):
+            num_successful_realizations = runner.run(run_context, runpath_creation)
+        # Read the final job statuses, so the job statistics are complete
+        self.updateDetailedProgress()
+        return num_successful_realizations
+
+
+    def runWorkflows(self, hook_runtime):
+        with self.span("%s workflows" % hook_runtime, category="workflow"):
+            EnkfSimulationRunner.runWorkflows(hook_runtime, ert=ERT.ert)
+
+
+    def span(self, name, category="phase"):
+        """Times the enclosed block as a span named @name in the profile of
+        the run, see profiler()."""
+        return self._profiler.span(name, category)
+
+
+    def profiler(self):
+        """ @rtype: PhaseProfiler """
+        return self._profiler
+
+
     @job_queue(None)
     def killAllSimulations(self):
-        self._job_queue.kill_all_jobs()
+        with self._queue_lock:
+            self._job_queue.kill_all_jobs()
 
 
     @job_queue(False)
     def userExitCalled(self):
         """ @rtype: bool """
-        return self._job_queue.getUserExit( )
+        with self._queue_lock:
+            return self._job_queue.getUserExit( )
 
 
     def phaseCount(self):
@@ -119,6 +328,7 @@ class BaseRunModel(object):
     def setPhaseName(self, phase_name, indeterminate=None):
         self._phase_name = phase_name
         self.setIndeterminate(indeterminate)
+        self._publishPhaseChange()
 
 
     def getPhaseName(self):
@@ -151,7 +361,7 @@ class BaseRunModel(object):
 
 
     def setPhase(self, phase, phase_name, indeterminate=None):
-        self.setPhaseName(phase_name)
+        self._phase_name = phase_name
         if not 0 <= phase <= self._phase_count:
             raise ValueError("Phase must be an integer from 0 to less than %d." % self._phase_count)
 
@@ -164,6 +374,34 @@ class BaseRunModel(object):
             self._simulationEnded()
 
         self._phase = phase
+        self._publishPhaseChange()
+
+    def subscribe(self, state_changes=None):
+        """Returns a queue receiving the state changes of this model as they
+        happen; PhaseChangeEvents and JobStatusChangeEvents. Consumers can
+        block on the queue instead of polling the model, or give their own
+        @state_changes with a put method to be notified directly.
+        @rtype: Queue"""
+        if state_changes is None:
+            state_changes = Queue()
+        with self._subscriber_lock:
+            self._subscribers.append(state_changes)
+        return state_changes
+
+    def unsubscribe(self, state_changes):
+        with self._subscriber_lock:
+            if state_changes in self._subscribers:
+                self._subscribers.remove(state_changes)
+
+    def publish(self, event):
+        with self._subscriber_lock:
+            subscribers = list(self._subscribers)
+
+        for state_changes in subscribers:
+            state_changes.put(event)
+
+    def _publishPhaseChange(self):
+        self.publish(PhaseChangeEvent(self._phase, self._phase_name, self.isFinished()))
 
     def stop_time(self):
         return self._job_stop_time
@@ -174,7 +412,8 @@ class BaseRunModel(object):
     @job_queue(1)
     def getQueueSize(self):
         """ @rtype: int """
-        queue_size = len(self._job_queue)
+        with self._queue_lock:
+            queue_size = len(self._job_queue)
 
         if queue_size == 0:
             queue_size = 1
@@ -184,22 +423,18 @@ class BaseRunModel(object):
     @job_queue({})
     def getQueueStatus(self):
         """ @rtype: dict of (JobStatusType, int) """
-        queue_status = {}
-
-        for job_number in range(len(self._job_queue)):
-            status = self._job_queue.getJobStatus(job_number)
-
-            if not status in queue_status:
-                queue_status[status] = 0
+        return self._job_queue_watcher.getStatusCounts()
 
-            queue_status[status] += 1
-
-        return queue_status
+    @job_queue({})
+    def getStragglers(self):
+        """ @rtype: dict of (int, float) with the seconds running per queue index """
+        return self._job_queue_watcher.getStragglers()
 
     @job_queue(False)
     def isQueueRunning(self):
         """ @rtype: bool """
-        return self._job_queue.isRunning()
+        with self._queue_lock:
+            return self._job_queue.isRunning()
 
     @staticmethod
     def is_forward_model_finished(progress):
@@ -215,8 +450,9 @@ class BaseRunModel(object):
             return
 
         status = None
-        if self._job_queue:
-            status = self._job_queue.getJobStatus(queue_index)
+        with self._queue_lock:
+            if self._job_queue:
+                status = self._job_queue.getJobStatus(queue_index)
 
         if status in [
                 JobStatusType.JOB_QUEUE_PENDING,
@@ -231,12 +467,27 @@ class BaseRunModel(object):
         if fms and BaseRunModel.is_forward_model_finished(fms[0]):
             jobs = self.realization_progress[iteration][run_arg.iens][0]
         else:
-            fms = ForwardModelStatus.load(run_arg.runpath, num_retry=1)
-            if not fms:
-                return
+            signature = self._status_file_watcher.changed(run_arg.runpath)
+            if fms and signature is None:
+                # The status file has not changed since it was last loaded
+                jobs = fms[0]
+            else:
+                fms = ForwardModelStatus.load(run_arg.runpath, num_retry=1)
+                if not fms:
+                    return
+
+                jobs = fms.jobs
+                if signature is not None:
+                    self._status_file_watcher.loaded(run_arg.runpath, signature)
 
-            jobs = fms.jobs
-        self.realization_progress[iteration][run_arg.iens] = jobs, status
+        with self._progress_lock:
+            previous = self.realization_progress[iteration].get(run_arg.iens)
+            if previous is None or previous[0] is not jobs or previous[1] != status:
+                self.realization_progress[iteration][run_arg.iens] = jobs, status
+                self._progress_sequence += 1
+                self._progress_changes.pop((iteration, run_arg.iens), None)
+                self._progress_changes[(iteration, run_arg.iens)] = self._progress_sequence
+                self._job_telemetry.record(iteration, run_arg.iens, jobs)
 
 
     @job_queue({})
@@ -245,8 +496,9 @@ class BaseRunModel(object):
             return
 
         iteration = self._run_context.get_iter()
-        if iteration not in self.realization_progress:
-            self.realization_progress[iteration] = {}
+        with self._progress_lock:
+            if iteration not in self.realization_progress:
+                self.realization_progress[iteration] = {}
 
         try:
             # Run context might be set to None by concurrent threads,
@@ -263,26 +515,89 @@ class BaseRunModel(object):
             else:
                 raise
 
+    def watchDetailedProgress(self):
+        """Registers a consumer polling the detailed progress regularly, such
+        as the run dialog. While there are any, the status files are read by
+        the status file watcher in the background during a simulation.
+        Otherwise they are read when the detailed progress is requested.
+        Each call must be matched by a call to unwatchDetailedProgress."""
+        with self._status_watch_lock:
+            self._detailed_progress_watchers += 1
+            if self._simulating and not self._status_file_watcher.isRunning():
+                self._status_file_watcher.start()
+
+    def unwatchDetailedProgress(self):
+        with self._status_watch_lock:
+            self._detailed_progress_watchers -= 1
+            if self._detailed_progress_watchers == 0:
+                self._status_file_watcher.stop()
+
     def getDetailedProgress(self):
-        self.updateDetailedProgress()
+        # While the status file watcher runs, the status files are read in
+        # the background and a snapshot is returned here.
+        if not self._status_file_watcher.isRunning():
+            self.updateDetailedProgress()
 
-        if self._run_context and self._run_context.get_iter() in self.realization_progress:
-            return self.realization_progress, self._run_context.get_iter()
+        with self._progress_lock:
+            realization_progress = {iteration: dict(progress)
+                                    for iteration, progress in self.realization_progress.items()}
 
-        elif self._last_run_iteration in self.realization_progress:
-            return self.realization_progress, self._last_run_iteration
+        iteration = self._progressIteration(realization_progress)
+        if iteration < 0:
+            return {}, -1
+        return realization_progress, iteration
+
+    def getDetailedProgressChanges(self, since=0):
+        """Returns the realization progress entries that have changed after
+        sequence number @since, together with the current iteration and the
+        sequence number to pass as @since next time. The changes are on the
+        same form as the progress from getDetailedProgress, so @since=0 gives
+        every entry there is. The cost is proportional to the number of
+        changes, not to the number of realizations.
+        @rtype: (dict, int, int)"""
+        if not self._status_file_watcher.isRunning():
+            self.updateDetailedProgress()
+
+        with self._progress_lock:
+            changes = {}
+            for iteration, iens in reversed(self._progress_changes):
+                if self._progress_changes[(iteration, iens)] <= since:
+                    break
+                changes.setdefault(iteration, {})[iens] = self.realization_progress[iteration][iens]
+
+            iteration = self._progressIteration(self.realization_progress)
+            return changes, iteration, self._progress_sequence
+
+    def getJobStatistics(self, iteration=None):
+        """Runtime and peak memory usage statistics per forward model job,
+        over the successful jobs of @iteration or of every iteration, as of
+        the last detailed progress update. See JobTelemetry.summary.
+        @rtype: dict of (str, dict)"""
+        return self._job_telemetry.summary(iteration)
+
+    def _progressIteration(self, realization_progress):
+        run_context = self._run_context
+        if run_context and run_context.get_iter() in realization_progress:
+            return run_context.get_iter()
+
+        elif self._last_run_iteration in realization_progress:
+            return self._last_run_iteration
 
         else:
-            return {}, -1
+            return -1
 
     def isIndeterminate(self):
         """ @rtype: bool """
         return not self.isFinished() and self._indeterminate
 
+    def haveSufficientRealizations(self, num_successful_realizations):
+        """ @rtype: bool """
+        return self.ert().analysisConfig().haveEnoughRealisations(num_successful_realizations, self._ensemble_size)
+
     def checkHaveSufficientRealizations(self, num_successful_realizations):
         if num_successful_realizations == 0:
             raise ErtRunError("Simulation failed! All realizations failed!")
-        elif not self.ert().analysisConfig().haveEnoughRealisations(num_successful_realizations, self._ensemble_size):
+        elif not self.haveSufficientRealizations(num_successful_realizations):
             raise ErtRunError("Too many simulations have failed! You can add/adjust MIN_REALIZATIONS to allow failures in your simulations.\n\n"
                               "Check ERT log file '%s' or simulation folder for details." % ResLog.getFilename())
 
@@ -1,5 +1,5 @@
 from res.enkf.enums import HookRuntime
-from res.enkf import ErtRunContext, EnkfSimulationRunner
+from res.enkf import ErtRunContext
 
 from ert_shared.models import BaseRunModel
 from ert_shared import ERT
@@ -10,6 +10,7 @@ class EnsembleExperiment(BaseRunModel):
 
     def __init__(self):
         super(EnsembleExperiment, self).__init__(ERT.enkf_facade.get_queue_config())
+        self.support_fast_restart = True
 
     def runSimulations__(self, arguments, run_msg):
 
@@ -19,21 +20,21 @@ class EnsembleExperiment(BaseRunModel):
         self.setPhase(0, "Running simulations...", indeterminate=False)
 
         self.setPhaseName("Pre processing...", indeterminate=True)
-        self.ert().getEnkfSimulationRunner().createRunPath( run_context )
-        EnkfSimulationRunner.runWorkflows(HookRuntime.PRE_SIMULATION, ERT.ert)
+        runpath_creation = self.prepareRunPath( run_context )
 
         self.setPhaseName( run_msg, indeterminate=False)
 
-        num_successful_realizations = self.ert().getEnkfSimulationRunner().runEnsembleExperiment(self._job_queue, run_context)
+        num_successful_realizations = self.runSimpleStep(run_context, runpath_creation=runpath_creation)
 
         num_successful_realizations += arguments.get('prev_successful_realizations', 0)
         self.checkHaveSufficientRealizations(num_successful_realizations)
 
         self.setPhaseName("Post processing...", indeterminate=True)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.POST_SIMULATION, ERT.ert)
+        self.runWorkflows(HookRuntime.POST_SIMULATION)
         self.setPhase(1, "Simulations completed.") # done...
 
-        dump_to_new_storage()
+        with self.span("Store results"):
+            dump_to_new_storage(job_statistics=self.getJobStatistics(run_context.get_iter()))
 
         return run_context
 
@@ -42,6 +43,33 @@ class EnsembleExperiment(BaseRunModel):
         return self.runSimulations__(  arguments , "Running ensemble experiment...")
 
 
+    def rerunSimulations(self, arguments):
+        # A fresh queue, so the queue status only counts the restarted jobs
+        self._job_queue = self._queue_config.create_job_queue( )
+        run_context = self.create_context( arguments )
+
+        self.setPhase(0, "Restarting failed realizations...", indeterminate=False)
+
+        # The runpaths are only created again if some have been removed
+        if self.missingRunPaths(run_context):
+            self.setPhaseName("Pre processing...", indeterminate=True)
+            self.createRunPath( run_context )
+            self.setPhaseName("Restarting failed realizations...", indeterminate=False)
+        self.clearRunPathStatus(run_context)
+
+        num_successful_realizations = self.runSimpleStep(run_context)
+
+        num_successful_realizations += arguments.get('prev_successful_realizations', 0)
+        self.checkHaveSufficientRealizations(num_successful_realizations)
+
+        self.setPhase(1, "Simulations completed.")
+
+        with self.span("Store results"):
+            dump_to_new_storage(job_statistics=self.getJobStatistics(run_context.get_iter()))
+
+        return run_context
+
+
     def create_context(self, arguments):
         fs_manager = self.ert().getEnkfFsManager()
         result_fs = fs_manager.getCurrentFileSystem( )
@@ -1,6 +1,6 @@
 from res.enkf.enums import HookRuntime
 from res.enkf.enums import RealizationStateEnum
-from res.enkf import ErtRunContext, EnkfSimulationRunner
+from res.enkf import ErtRunContext
 from ert_shared.models import BaseRunModel, ErtRunError
 from ert_shared import ERT
 
@@ -27,28 +27,29 @@ class EnsembleSmoother(BaseRunModel):
         # self.setAnalysisModule(arguments["analysis_module"])
 
         self.setPhaseName("Pre processing...", indeterminate=True)
-        self.ert().getEnkfSimulationRunner().createRunPath(prior_context)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.PRE_SIMULATION, ert=ERT.ert)
+        runpath_creation = self.prepareRunPath(prior_context)
 
         self.setPhaseName("Running forecast...", indeterminate=False)
         self._job_queue = self._queue_config.create_job_queue( )
-        num_successful_realizations = self.ert().getEnkfSimulationRunner().runSimpleStep(self._job_queue, prior_context)
+        num_successful_realizations = self.runSimpleStep(prior_context, runpath_creation=runpath_creation)
 
         self.checkHaveSufficientRealizations(num_successful_realizations)
 
         self.setPhaseName("Post processing...", indeterminate=True)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.POST_SIMULATION, ert=ERT.ert )
+        self.runWorkflows(HookRuntime.POST_SIMULATION)
 
         self.setPhaseName("Analyzing...")
 
-        EnkfSimulationRunner.runWorkflows(HookRuntime.PRE_UPDATE, ert=ERT.ert )
+        self.runWorkflows(HookRuntime.PRE_UPDATE)
         es_update = self.ert().getESUpdate( )
-        success = es_update.smootherUpdate( prior_context )
+        with self.span("Update"):
+            success = es_update.smootherUpdate( prior_context )
         if not success:
             raise ErtRunError("Analysis of simulation failed!")
-        EnkfSimulationRunner.runWorkflows(HookRuntime.POST_UPDATE, ert=ERT.ert )
+        self.runWorkflows(HookRuntime.POST_UPDATE)
 
-        previous_ensemble_name = dump_to_new_storage(reference=None)
+        with self.span("Store results"):
+            previous_ensemble_name = dump_to_new_storage(reference=None, job_statistics=self.getJobStatistics(prior_context.get_iter()))
 
         self.setPhase(1, "Running simulations...")
         self.ert().getEnkfFsManager().switchFileSystem( prior_context.get_target_fs( ) )
@@ -57,23 +58,24 @@ class EnsembleSmoother(BaseRunModel):
 
         rerun_context = self.create_context( arguments, prior_context = prior_context )
 
-        self.ert().getEnkfSimulationRunner().createRunPath( rerun_context )
-        EnkfSimulationRunner.runWorkflows(HookRuntime.PRE_SIMULATION, ert=ERT.ert )
+        runpath_creation = self.prepareRunPath( rerun_context )
 
         self.setPhaseName("Running forecast...", indeterminate=False)
 
         self._job_queue = self._queue_config.create_job_queue( )
-        num_successful_realizations = self.ert().getEnkfSimulationRunner().runSimpleStep(self._job_queue, rerun_context)
+        num_successful_realizations = self.runSimpleStep(rerun_context, runpath_creation=runpath_creation)
 
         self.checkHaveSufficientRealizations(num_successful_realizations)
 
         self.setPhaseName("Post processing...", indeterminate=True)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.POST_SIMULATION, ert=ERT.ert)
+        self.runWorkflows(HookRuntime.POST_SIMULATION)
 
         self.setPhase(2, "Simulations completed.")
 
         analysis_module_name = self.ert().analysisConfig().activeModuleName()
-        dump_to_new_storage(reference=(previous_ensemble_name, analysis_module_name))
+        with self.span("Store results"):
+            dump_to_new_storage(reference=(previous_ensemble_name, analysis_module_name),
+                                job_statistics=self.getJobStatistics(rerun_context.get_iter()))
 
         return prior_context
 
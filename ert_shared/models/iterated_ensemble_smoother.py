@@ -1,5 +1,5 @@
 from res.enkf.enums import HookRuntime
-from res.enkf import ErtRunContext, EnkfSimulationRunner
+from res.enkf import ErtRunContext
 from ert_shared.models import BaseRunModel, ErtRunError
 from ert_shared import ERT
 
@@ -9,6 +9,7 @@ class IteratedEnsembleSmoother(BaseRunModel):
     def __init__(self):
         super(IteratedEnsembleSmoother, self).__init__(ERT.enkf_facade.get_queue_config() , phase_count=2)
         self.support_restart = False
+        self._straggler_timeout = None
 
     def setAnalysisModule(self, module_name):
         module_load_success = self.ert().analysisConfig().selectModule(module_name)
@@ -25,16 +26,15 @@ class IteratedEnsembleSmoother(BaseRunModel):
         self.setPhase(run_context.get_iter(), phase_msg, indeterminate=False)
 
         self.setPhaseName("Pre processing...", indeterminate=True)
-        self.ert().getEnkfSimulationRunner().createRunPath( run_context )
-        EnkfSimulationRunner.runWorkflows(HookRuntime.PRE_SIMULATION, ert=ERT.ert)
+        runpath_creation = self.prepareRunPath( run_context )
 
         self.setPhaseName("Running forecast...", indeterminate=False)
-        num_successful_realizations = self.ert().getEnkfSimulationRunner().runSimpleStep(self._job_queue, run_context)
+        num_successful_realizations = self.runSimpleStep(run_context, self._straggler_timeout, runpath_creation)
 
         self.checkHaveSufficientRealizations(num_successful_realizations)
 
         self.setPhaseName("Post processing...", indeterminate=True)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.POST_SIMULATION, ert=ERT.ert)
+        self.runWorkflows(HookRuntime.POST_SIMULATION)
 
 
     def createTargetCaseFileSystem(self, phase, target_case_format):
@@ -48,21 +48,23 @@ class IteratedEnsembleSmoother(BaseRunModel):
         source_fs = self.ert().getEnkfFsManager().getCurrentFileSystem()
 
         self.setPhaseName("Pre processing update...", indeterminate=True)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.PRE_UPDATE, ert=ERT.ert)
+        self.runWorkflows(HookRuntime.PRE_UPDATE)
         es_update = self.ert().getESUpdate()
 
-        success = es_update.smootherUpdate(run_context)
+        with self.span("Update"):
+            success = es_update.smootherUpdate(run_context)
         if not success:
             raise ErtRunError("Analysis of simulation failed!")
 
         self.setPhaseName("Post processing update...", indeterminate=True)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.POST_UPDATE, ert=ERT.ert)
+        self.runWorkflows(HookRuntime.POST_UPDATE)
 
     def runSimulations(self, arguments):
         phase_count = ERT.enkf_facade.get_number_of_iterations() + 1
         self.setPhaseCount(phase_count)
 
         analysis_module = self.setAnalysisModule(arguments["analysis_module"])
+        self._straggler_timeout = arguments.get("straggler_timeout")
         target_case_format = arguments["target_case"]
         run_context = self.create_context( arguments , 0 )
 
@@ -85,7 +87,9 @@ class IteratedEnsembleSmoother(BaseRunModel):
             analysis_success = current_iter > pre_analysis_iter_num
             if analysis_success:
                 analysis_module_name = self.ert().analysisConfig().activeModuleName()
-                previous_ensemble_name = dump_to_new_storage(reference=None if previous_ensemble_name is None else (previous_ensemble_name, analysis_module_name))
+                with self.span("Store results"):
+                    previous_ensemble_name = dump_to_new_storage(reference=None if previous_ensemble_name is None else (previous_ensemble_name, analysis_module_name),
+                                                             job_statistics=self.getJobStatistics(run_context.get_iter()))
                 run_context = self.create_context( arguments, current_iter, prior_context = run_context )
                 self.ert().getEnkfFsManager().switchFileSystem(run_context.get_target_fs())
                 self._runAndPostProcess(run_context)
@@ -96,7 +100,9 @@ class IteratedEnsembleSmoother(BaseRunModel):
                 num_retries += 1
 
         analysis_module_name = self.ert().analysisConfig().activeModuleName()
-        previous_ensemble_name = dump_to_new_storage(reference=None if previous_ensemble_name is None else (previous_ensemble_name, analysis_module_name))
+        with self.span("Store results"):
+            previous_ensemble_name = dump_to_new_storage(reference=None if previous_ensemble_name is None else (previous_ensemble_name, analysis_module_name),
+                                                             job_statistics=self.getJobStatistics(run_context.get_iter()))
         if current_iter == (phase_count - 1):
             self.setPhase(phase_count, "Simulations completed.")
         else:
@@ -0,0 +1,207 @@
+import logging
+import time
+
+from res.enkf import EnKFState
+from res.enkf.enums import RealizationStateEnum, RunStatusType
+
+logger = logging.getLogger(__name__)
+
+
+class JobQueueRunner(object):
+    """Runs the forward models of a run context on a job queue and loads
+    their results, as runSimpleStep of the libres EnkfSimulationRunner does
+    with start_queue and a JobQueueManager. Unlike runSimpleStep, the
+    realizations can be added to the queue one at a time, as soon as their
+    runpaths are ready, while a RunpathCreation is still creating the rest.
+    The first realizations then start running on the cluster within
+    seconds, instead of once every runpath has been written.
+
+    Adding a realization to the queue reads the queue configuration and the
+    run_arg of that realization, neither of which are changed by the
+    runpath creation. Loading the results of a finished realization writes
+    to the storage, so the libres lock is passed to the queue as the
+    semaphore it holds while running the callbacks of a job, and the results
+    are loaded one realization at a time, and not while runpaths are being
+    created.
+
+    The evaluators are called under the queue lock after every poll, as the
+    JobQueueManager calls its queue evaluators. When the user stops the
+    queue, the jobs are killed and the queue is checked to be complete, as
+    JobQueue.execute_queue does.
+
+    With a @profiler, the time from the first submission until a job first
+    runs or completes is recorded as a queue wait span, and each load of the
+    results of a finished job as a result loading span, see PhaseProfiler.
+
+    As in runSimpleStep, a realization has failed when loading or running it
+    failed according to the status of its run_arg. A realization that was
+    never added to the queue, as the queue was stopped before its runpath
+    was ready, has failed as well.
+    """
+
+    FAILED = (RunStatusType.JOB_LOAD_FAILURE, RunStatusType.JOB_RUN_FAILURE)
+
+    POLL_INTERVAL = 1.0  # As the JobQueueManager of libres
+
+    def __init__(
+        self,
+        ert,
+        job_queue,
+        queue_lock,
+        libres_lock,
+        evaluators=(),
+        poll_interval=POLL_INTERVAL,
+        profiler=None,
+    ):
+        self._ert = ert
+        self._job_queue = job_queue
+        self._queue_lock = queue_lock
+        self._libres_lock = libres_lock
+        self._evaluators = list(evaluators)
+        self._poll_interval = poll_interval
+        self._profiler = profiler
+
+    def run(self, run_context, runpath_creation=None):
+        """Runs the active realizations of @run_context, deactivates those
+        that did not succeed, and returns the number that did. Without
+        @runpath_creation, all the runpaths must already exist. Errors from
+        the runpath creation are raised here, after the jobs are killed.
+        @rtype: int"""
+        with self._libres_lock:
+            if runpath_creation is None:
+                # The runpath creation initializes the run itself
+                self._ert.initRun(run_context)
+            if run_context.get_step():
+                self._ert.eclConfig().assert_restart()
+            run_context.get_sim_fs().getStateMap().deselectMatching(
+                run_context.get_mask(),
+                RealizationStateEnum.STATE_LOAD_FAILURE
+                | RealizationStateEnum.STATE_PARENT_FAILURE,
+            )
+            res_config = self._ert.resConfig()
+            max_runtime = self._ert.analysisConfig().get_max_runtime() or None
+
+        try:
+            submitted = self._execute(
+                run_context, runpath_creation, res_config, max_runtime
+            )
+        except Exception:
+            with self._queue_lock:
+                self._job_queue.kill_all_jobs()
+            raise
+
+        return self._deactivateFailed(run_context, submitted)
+
+    def _execute(self, run_context, runpath_creation, res_config, max_runtime):
+        submitted = set()
+        submit_complete = False
+        stopped = False
+        # Start of the queue wait, until it is recorded
+        queue_wait = None
+        queue_wait_recorded = False
+        while True:
+            if not submit_complete:
+                if runpath_creation is None:
+                    ready = [
+                        iens
+                        for iens in range(len(run_context))
+                        if run_context.is_active(iens)
+                    ]
+                    submit_complete = True
+                else:
+                    submit_complete = runpath_creation.isDone()
+                    if submit_complete:
+                        runpath_creation.wait()
+                    ready = runpath_creation.readyRealizations()
+
+                self._submit(
+                    run_context,
+                    [iens for iens in ready if iens not in submitted],
+                    res_config,
+                    max_runtime,
+                )
+                submitted.update(ready)
+                if queue_wait is None and submitted and self._profiler is not None:
+                    queue_wait = self._profiler.now()
+                if submit_complete:
+                    with self._queue_lock:
+                        self._job_queue.submit_complete()
+
+            with self._queue_lock:
+                if self._job_queue.getUserExit():
+                    stopped = True
+                    break
+                self._job_queue.launch_jobs(self._libres_lock)
+                if (
+                    queue_wait is not None
+                    and not queue_wait_recorded
+                    and (self._job_queue.num_running or self._job_queue.num_complete)
+                ):
+                    self._profiler.record(
+                        "Queue wait", queue_wait, self._profiler.now(), "queue"
+                    )
+                    queue_wait_recorded = True
+                if submit_complete and not self._job_queue.is_active():
+                    break
+
+            time.sleep(self._poll_interval)
+            for evaluator in self._evaluators:
+                with self._queue_lock:
+                    evaluator()
+
+        if queue_wait is not None and not queue_wait_recorded:
+            # No job ever ran
+            self._profiler.record(
+                "Queue wait", queue_wait, self._profiler.now(), "queue"
+            )
+
+        with self._queue_lock:
+            if stopped:
+                self._job_queue.kill_all_jobs()
+            self._job_queue.assert_complete()
+
+        if runpath_creation is not None and not submit_complete:
+            # Stopped by the user; EnKFMain is in use until the creation ends
+            runpath_creation.wait()
+        return submitted
+
+    def _loadResults(self, *callback_arguments):
+        with self._profiler.span("Load results", category="load"):
+            return EnKFState.forward_model_ok_callback(*callback_arguments)
+
+    def _submit(self, run_context, realizations, res_config, max_runtime):
+        if not realizations:
+            return
+
+        ok_callback = EnKFState.forward_model_ok_callback
+        if self._profiler is not None:
+            ok_callback = self._loadResults
+
+        with self._queue_lock:
+            for iens in realizations:
+                self._job_queue.add_job_from_run_arg(
+                    run_context[iens],
+                    res_config,
+                    max_runtime,
+                    ok_callback,
+                    EnKFState.forward_model_exit_callback,
+                )
+        logger.debug("Submitted %d realizations", len(realizations))
+
+    def _deactivateFailed(self, run_context, submitted):
+        succeeded = 0
+        with self._libres_lock:
+            for iens in range(len(run_context)):
+                if not run_context.is_active(iens):
+                    continue
+
+                if (
+                    iens in submitted
+                    and run_context[iens].run_status not in JobQueueRunner.FAILED
+                ):
+                    succeeded += 1
+                else:
+                    run_context.deactivate_realization(iens)
+
+            run_context.get_sim_fs().fsync()
+        return succeeded
@@ -0,0 +1,203 @@
+import logging
+import threading
+import time
+
+import numpy
+from res.job_queue import JobStatusType
+
+from ert_shared.tracker.events import JobStatusChangeEvent, StragglerEvent
+
+logger = logging.getLogger(__name__)
+
+
+class JobQueueWatcher(object):
+    """Watches the job queue of a run model from a single background thread
+    and publishes the job status transitions it sees as JobStatusChangeEvents.
+
+    The job queue does not notify about status changes, so this is the one
+    place the queue is polled while a simulation runs, once a second. The
+    statuses are read holding @queue_lock, which the run model holds for all
+    its access to the job queue. Consumers subscribe to the run model and are woken up only
+    when something has changed.
+
+    The time each job spends running is taken from the transitions. Once
+    MIN_COMPLETED jobs have completed, a job that has been running for
+    longer than @straggler_percentile of the completed runtimes is a
+    straggler, and a StragglerEvent is published whenever the set of
+    stragglers changes, so the trackers send a GeneralEvent with the
+    stragglers right away. The CLI monitor shows them and the event feed
+    writes them. Stragglers are only reported; no duplicate of a straggler
+    is launched, as a duplicate would need a runpath and a run_arg of its
+    own, and both copies would load their results into the same
+    realization of the case.
+    """
+
+    POLL_INTERVAL = 1.0
+    STRAGGLER_PERCENTILE = 90
+    MIN_COMPLETED = 5
+
+    COMPLETED = (
+        JobStatusType.JOB_QUEUE_RUNNING_DONE_CALLBACK,
+        JobStatusType.JOB_QUEUE_DONE,
+        JobStatusType.JOB_QUEUE_SUCCESS,
+    )
+
+    def __init__(
+        self,
+        get_job_queue,
+        publish,
+        poll_interval=POLL_INTERVAL,
+        straggler_percentile=STRAGGLER_PERCENTILE,
+        clock=time.time,
+        queue_lock=None,
+    ):
+        self._get_job_queue = get_job_queue
+        self._publish = publish
+        self._poll_interval = poll_interval
+        self._straggler_percentile = straggler_percentile
+        self._clock = clock
+        self._queue_lock = queue_lock if queue_lock is not None else threading.Lock()
+        self._job_queue = None
+        self._statuses = []
+        self._status_counts = {}
+        self._running_since = {}
+        self._runtimes = []
+        self._stragglers = {}
+        self._lock = threading.Lock()
+        self._stop_event = threading.Event()
+        self._thread = None
+
+    def start(self):
+        self._stop_event.clear()
+        self._thread = threading.Thread(
+            name="ert_job_queue_watcher", target=self._watch
+        )
+        self._thread.daemon = True
+        self._thread.start()
+
+    def stop(self):
+        self._stop_event.set()
+        if self._thread is not None:
+            self._thread.join()
+            self._thread = None
+
+        # Publish whatever happened since the last poll
+        self.poll()
+
+    def _watch(self):
+        while not self._stop_event.wait(self._poll_interval):
+            self.poll()
+
+    def poll(self):
+        """Reads the status of every job in the queue and publishes the
+        transitions since the previous poll. A new job queue (e.g. for the
+        next iteration) is reported as transitions from None.
+        @rtype: dict of (int, (JobStatusType, JobStatusType))"""
+        job_queue = self._get_job_queue()
+        if job_queue is None:
+            return {}
+
+        with self._queue_lock:
+            statuses = [
+                job_queue.getJobStatus(queue_index)
+                for queue_index in range(len(job_queue))
+            ]
+
+        now = self._clock()
+        with self._lock:
+            changes = self._update(job_queue, statuses, now)
+            previous_stragglers = self._stragglers
+            limit = self._runtimeLimit()
+            self._stragglers = self._findStragglers(limit, now)
+            stragglers = dict(self._stragglers)
+
+        if changes:
+            self._publish(JobStatusChangeEvent(changes))
+
+        if set(stragglers) != set(previous_stragglers):
+            for queue_index in sorted(set(stragglers) - set(previous_stragglers)):
+                logger.info(
+                    "Job %d has been running for %d seconds, longer than %d%% "
+                    "of the completed jobs (%d seconds)",
+                    queue_index,
+                    stragglers[queue_index],
+                    self._straggler_percentile,
+                    limit,
+                )
+            self._publish(StragglerEvent(stragglers, limit))
+        return changes
+
+    def getStatusCounts(self):
+        """Number of jobs in each status, as of the last poll. This does not
+        read the job queue, so a job queue that has not been polled yet has
+        no counts.
+        @rtype: dict of (JobStatusType, int)"""
+        job_queue = self._get_job_queue()
+        if job_queue is None:
+            return {}
+
+        with self._lock:
+            if job_queue is not self._job_queue:
+                return {}
+            return dict(self._status_counts)
+
+    def getStragglers(self):
+        """The jobs that are stragglers as of the last poll, with the number
+        of seconds they have been running.
+        @rtype: dict of (int, float)"""
+        with self._lock:
+            return dict(self._stragglers)
+
+    def _update(self, job_queue, statuses, now):
+        if job_queue is not self._job_queue:
+            self._job_queue = job_queue
+            self._statuses = []
+            self._status_counts = {}
+            self._running_since = {}
+            self._runtimes = []
+
+        changes = {}
+        for queue_index, status in enumerate(statuses):
+            previous = None
+            if queue_index < len(self._statuses):
+                previous = self._statuses[queue_index]
+            if status != previous:
+                changes[queue_index] = (previous, status)
+                self._count(previous, -1)
+                self._count(status, 1)
+                self._time(queue_index, previous, status, now)
+
+        self._statuses = statuses
+        return changes
+
+    def _count(self, status, delta):
+        if status is None:
+            return
+
+        count = self._status_counts.get(status, 0) + delta
+        if count:
+            self._status_counts[status] = count
+        else:
+            del self._status_counts[status]
+
+    def _time(self, queue_index, previous, status, now):
+        if status == JobStatusType.JOB_QUEUE_RUNNING:
+            self._running_since[queue_index] = now
+        elif previous == JobStatusType.JOB_QUEUE_RUNNING:
+            started = self._running_since.pop(queue_index, None)
+            if started is not None and status in JobQueueWatcher.COMPLETED:
+                self._runtimes.append(now - started)
+
+    def _runtimeLimit(self):
+        if len(self._runtimes) < JobQueueWatcher.MIN_COMPLETED:
+            return None
+        return float(numpy.percentile(self._runtimes, self._straggler_percentile))
+
+    def _findStragglers(self, limit, now):
+        if limit is None:
+            return {}
+        return {
+            queue_index: now - started
+            for queue_index, started in self._running_since.items()
+            if now - started > limit
+        }
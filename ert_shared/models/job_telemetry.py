@@ -0,0 +1,95 @@
+import threading
+
+import numpy
+
+
+class JobTelemetry(object):
+    """Collects the runtime and peak memory usage of every successful
+    forward model job, as read from the status files of the realizations,
+    and summarizes them per job name.
+
+    A job is recorded once per iteration and realization, the first time it
+    is seen to have succeeded.
+    """
+
+    PERCENTILES = (50, 95)
+    SUCCESS = "Success"
+
+    def __init__(self):
+        self._samples = {}
+        self._recorded = set()
+        self._summaries = {}
+        self._lock = threading.Lock()
+
+    def reset(self):
+        """Forgets every recorded job."""
+        with self._lock:
+            self._samples = {}
+            self._recorded = set()
+            self._summaries = {}
+
+    def record(self, iteration, iens, jobs):
+        """Records the successful jobs in @jobs, the forward model jobs of
+        realization @iens in @iteration."""
+        with self._lock:
+            for index, job in enumerate(jobs):
+                key = (iteration, iens, index)
+                if job.status != JobTelemetry.SUCCESS or key in self._recorded:
+                    continue
+
+                self._recorded.add(key)
+                runtimes, memory_usages, count = self._samples.get(
+                    (iteration, job.name), ([], [], 0)
+                )
+                self._samples[(iteration, job.name)] = (
+                    runtimes,
+                    memory_usages,
+                    count + 1,
+                )
+                if job.start_time is not None and job.end_time is not None:
+                    runtimes.append((job.end_time - job.start_time).total_seconds())
+                if job.max_memory_usage:
+                    memory_usages.append(float(job.max_memory_usage))
+                self._summaries.pop(iteration, None)
+                self._summaries.pop(None, None)
+
+    def summary(self, iteration=None):
+        """Percentiles and maximum of the runtime in seconds and of the peak
+        memory usage per job name, over @iteration or over all iterations.
+        A statistic is None if no job reported it.
+        @rtype: dict of (str, dict)"""
+        with self._lock:
+            if iteration not in self._summaries:
+                self._summaries[iteration] = self._summarize(iteration)
+            return self._summaries[iteration]
+
+    def _summarize(self, iteration):
+        samples = {}
+        counts = {}
+        for (sample_iteration, name), sample in self._samples.items():
+            if iteration is not None and sample_iteration != iteration:
+                continue
+            runtimes, memory_usages, count = sample
+            job_runtimes, job_memory_usages = samples.setdefault(name, ([], []))
+            job_runtimes.extend(runtimes)
+            job_memory_usages.extend(memory_usages)
+            counts[name] = counts.get(name, 0) + count
+
+        return {
+            name: {
+                "count": counts[name],
+                "runtime": JobTelemetry._statistics(runtimes),
+                "max_memory_usage": JobTelemetry._statistics(memory_usages),
+            }
+            for name, (runtimes, memory_usages) in samples.items()
+        }
+
+    @staticmethod
+    def _statistics(values):
+        statistics = {"max": float(max(values)) if values else None}
+        for percentile in JobTelemetry.PERCENTILES:
+            key = "p{}".format(percentile)
+            statistics[key] = (
+                float(numpy.percentile(values, percentile)) if values else None
+            )
+        return statistics
@@ -15,16 +15,29 @@
 #  for more details.
 from res.enkf.enums import HookRuntime
 from res.enkf.enums import RealizationStateEnum
-from res.enkf import ErtRunContext, EnkfSimulationRunner
+from res.enkf import ErtRunContext
 
 from ert_shared.models import BaseRunModel, ErtRunError
 from ert_shared import ERT
-from ert_shared.storage.extraction_api import dump_to_new_storage
+from ert_shared.storage.extraction_api import dump_extraction, dump_to_new_storage, extract_from_libres
 import logging
 logger = logging.getLogger(__file__)
+
+
 class MultipleDataAssimilation(BaseRunModel):
     """
     Run Multiple Data Assimilation (MDA) Ensemble Smoother with custom weights.
+
+    In pipelined mode the runpaths of the next iteration are created in the
+    background as soon as the update and the POST_UPDATE workflows are done
+    and the results of the finished iteration have been read from libres,
+    while these results are written to storage. EnKFMain is not thread safe,
+    so nothing else uses it until the runpaths are created.
+
+    With a straggler timeout, the realizations still running that many
+    seconds after MIN_REALIZATIONS have succeeded are killed, and the
+    iteration goes on without them, unless STOP_LONG_RUNNING is set, see
+    BaseRunModel.runSimpleStep.
     """
     default_weights = "4, 2, 1"
 
@@ -57,26 +70,46 @@ class MultipleDataAssimilation(BaseRunModel):
         phase_string = "Running MDA ES %d iteration%s." % (iteration_count, ('s' if (iteration_count != 1) else ''))
         self.setPhaseName(phase_string, indeterminate=True)
 
+        pipelined = arguments.get("pipelined", False)
+        runpath_creation = None
         run_context = None
         previous_ensemble_name = None
         for iteration, weight in enumerate(weights):
-            run_context = self.create_context( arguments , iteration,  prior_context = run_context )
-            self._simulateAndPostProcess(run_context, arguments )
+            if runpath_creation is None:
+                run_context = self.create_context( arguments , iteration,  prior_context = run_context )
+            else:
+                run_context = self._activate_context(self.waitForRunPath(runpath_creation))
+            self._simulateAndPostProcess(run_context, arguments, create_runpath=runpath_creation is None)
 
-            EnkfSimulationRunner.runWorkflows(HookRuntime.PRE_UPDATE, ert=ERT.ert)
+            self.runWorkflows(HookRuntime.PRE_UPDATE)
             self.update( run_context , weights[iteration])
-            EnkfSimulationRunner.runWorkflows(HookRuntime.POST_UPDATE, ert=ERT.ert)
+            self.runWorkflows(HookRuntime.POST_UPDATE)
+
             analysis_module_name = self.ert().analysisConfig().activeModuleName()
-            previous_ensemble_name = dump_to_new_storage(reference=None if previous_ensemble_name is None else (previous_ensemble_name, analysis_module_name))
+            with self.span("Store results"):
+                with self._libres_lock:
+                    extraction = extract_from_libres(reference=None if previous_ensemble_name is None else (previous_ensemble_name, analysis_module_name))
+
+                if pipelined:
+                    next_context = self._create_run_context(arguments, iteration + 1, prior_context=run_context,
+                                                            update=iteration + 1 < len(weights))
+                    runpath_creation = self.startRunPathCreation(next_context)
+
+                previous_ensemble_name = dump_extraction(extraction, job_statistics=self.getJobStatistics(run_context.get_iter()))
 
         self.setPhaseName("Post processing...", indeterminate=True)
-        run_context = self.create_context( arguments , len(weights),  prior_context = run_context, update = False)
-        self._simulateAndPostProcess(run_context, arguments)
+        if runpath_creation is None:
+            run_context = self.create_context( arguments , len(weights),  prior_context = run_context, update = False)
+        else:
+            run_context = self._activate_context(self.waitForRunPath(runpath_creation))
+        self._simulateAndPostProcess(run_context, arguments, create_runpath=runpath_creation is None)
 
         self.setPhase(iteration_count + 2, "Simulations completed.")
 
         analysis_module_name = self.ert().analysisConfig().activeModuleName()
-        previous_ensemble_name = dump_to_new_storage(reference=None if previous_ensemble_name is None else (previous_ensemble_name, analysis_module_name))
+        with self.span("Store results"):
+            previous_ensemble_name = dump_to_new_storage(reference=None if previous_ensemble_name is None else (previous_ensemble_name, analysis_module_name),
+                                                             job_statistics=self.getJobStatistics(run_context.get_iter()))
 
         return run_context
 
@@ -93,34 +126,35 @@ class MultipleDataAssimilation(BaseRunModel):
 
         es_update = self.ert().getESUpdate( )
         es_update.setGlobalStdScaling(weight)
-        success = es_update.smootherUpdate( run_context )
+        with self.span("Update"):
+            success = es_update.smootherUpdate( run_context )
 
         if not success:
             raise UserWarning("Analysis of simulation failed for iteration: %d!" % next_iteration)
 
 
-    def _simulateAndPostProcess(self, run_context, arguments):
+    def _simulateAndPostProcess(self, run_context, arguments, create_runpath=True):
         self._job_queue = self._queue_config.create_job_queue( )
         iteration = run_context.get_iter( )
 
-        phase_string = "Running simulation for iteration: %d" % iteration
-        self.setPhaseName(phase_string, indeterminate=True)
-        self.ert().getEnkfSimulationRunner().createRunPath(run_context)
-
         phase_string = "Pre processing for iteration: %d" % iteration
-        self.setPhaseName(phase_string)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.PRE_SIMULATION, ert=ERT.ert)
+        self.setPhaseName(phase_string, indeterminate=True)
+        if create_runpath:
+            runpath_creation = self.prepareRunPath(run_context)
+        else:
+            runpath_creation = None
+            self.runWorkflows(HookRuntime.PRE_SIMULATION)
 
         phase_string = "Running forecast for iteration: %d" % iteration
         self.setPhaseName(phase_string, indeterminate=False)
-        num_successful_realizations = self.ert().getEnkfSimulationRunner().runSimpleStep(self._job_queue, run_context)
+        num_successful_realizations = self.runSimpleStep(run_context, arguments.get("straggler_timeout"), runpath_creation)
 
         num_successful_realizations += arguments.get('prev_successful_realizations', 0)
         self.checkHaveSufficientRealizations(num_successful_realizations)
 
         phase_string = "Post processing for iteration: %d" % iteration
         self.setPhaseName(phase_string, indeterminate=True)
-        EnkfSimulationRunner.runWorkflows(HookRuntime.POST_SIMULATION, ert=ERT.ert)
+        self.runWorkflows(HookRuntime.POST_SIMULATION)
         return num_successful_realizations
 
 
@@ -158,6 +192,12 @@ class MultipleDataAssimilation(BaseRunModel):
 
 
     def create_context(self, arguments, itr, prior_context = None, update = True):
+        run_context = self._create_run_context(arguments, itr, prior_context, update)
+        return self._activate_context(run_context)
+
+    def _create_run_context(self, arguments, itr, prior_context = None, update = True):
+        """Creates the run context for iteration @itr without making it the
+        current one. """
         target_case_format = arguments["target_case"]
         model_config = self.ert().getModelConfig( )
         runpath_fmt = model_config.getRunpathFormat( )
@@ -180,15 +220,17 @@ class MultipleDataAssimilation(BaseRunModel):
             for index, run_realization in enumerate(self.initial_realizations_mask):
                 mask[index] = mask[index] and run_realization
 
+        return ErtRunContext.ensemble_smoother( sim_fs, target_fs, mask, runpath_fmt, jobname_fmt, subst_list, itr)
+
+    def _activate_context(self, run_context):
         # Deleting a run_context removes the possibility to retrospectively
         # determine detailed progress. Thus, before deletion, the detailed
         # progress is stored.
         self.updateDetailedProgress()
 
-        run_context = ErtRunContext.ensemble_smoother( sim_fs, target_fs, mask, runpath_fmt, jobname_fmt, subst_list, itr)
         self._run_context = run_context
         self._last_run_iteration = run_context.get_iter()
-        self.ert().getEnkfFsManager().switchFileSystem(sim_fs)
+        self.ert().getEnkfFsManager().switchFileSystem(run_context.get_sim_fs())
         return run_context
 
     @classmethod
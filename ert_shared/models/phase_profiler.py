@@ -0,0 +1,114 @@
+import json
+import os
+import threading
+import time
+from collections import namedtuple
+from contextlib import contextmanager
+
+Span = namedtuple("Span", ["name", "category", "start", "duration", "thread"])
+
+
+class PhaseProfiler(object):
+    """Records wall-clock spans for the phases of a run, e.g. runpath
+    creation, workflows, forward models, updates and storage. Spans can be
+    recorded from any thread and may be nested.
+
+    The spans can be written as a Chrome trace (chrome://tracing or
+    https://ui.perfetto.dev) and summarized as total time per span name.
+    """
+
+    def __init__(self, clock=time.time):
+        self._clock = clock
+        self._spans = []
+        self._lock = threading.Lock()
+
+    def reset(self):
+        """Forgets the spans recorded so far."""
+        with self._lock:
+            self._spans = []
+
+    @contextmanager
+    def span(self, name, category="phase"):
+        start = self._clock()
+        try:
+            yield
+        finally:
+            self.record(name, start, self._clock(), category)
+
+    def now(self):
+        """The time on the clock of the profiler, for the start and end of
+        spans given to record."""
+        return self._clock()
+
+    def record(self, name, start, end, category="phase"):
+        """Records a span from @start to @end, for phases that do not begin
+        and end in the same block of code."""
+        span = Span(name, category, start, end - start, threading.current_thread().name)
+        with self._lock:
+            self._spans.append(span)
+
+    def spans(self):
+        """@rtype: list of Span"""
+        with self._lock:
+            return sorted(self._spans, key=lambda span: span.start)
+
+    def summary(self):
+        """Total time and number of spans per span name, the longest first.
+        @rtype: list of (str, float, int)"""
+        totals = {}
+        for span in self.spans():
+            total, count = totals.get(span.name, (0.0, 0))
+            totals[span.name] = (total + span.duration, count + 1)
+
+        return sorted(
+            ((name, total, count) for name, (total, count) in totals.items()),
+            key=lambda entry: entry[1],
+            reverse=True,
+        )
+
+    def formatSummary(self):
+        """@rtype: str"""
+        lines = ["{:<40} {:>10} {:>6}".format("Phase", "Seconds", "Count")]
+        for name, total, count in self.summary():
+            lines.append("{:<40} {:>10.1f} {:>6}".format(name, total, count))
+        return "\n".join(lines)
+
+    def chromeTrace(self):
+        """The spans as complete events in the Chrome trace event format,
+        with one track per thread.
+        @rtype: dict"""
+        spans = self.spans()
+        origin = spans[0].start if spans else 0.0
+        pid = os.getpid()
+
+        thread_ids = {}
+        events = []
+        for span in spans:
+            if span.thread not in thread_ids:
+                thread_ids[span.thread] = len(thread_ids) + 1
+                events.append(
+                    {
+                        "name": "thread_name",
+                        "ph": "M",
+                        "pid": pid,
+                        "tid": thread_ids[span.thread],
+                        "args": {"name": span.thread},
+                    }
+                )
+
+            events.append(
+                {
+                    "name": span.name,
+                    "cat": span.category,
+                    "ph": "X",
+                    "ts": int((span.start - origin) * 1e6),
+                    "dur": int(span.duration * 1e6),
+                    "pid": pid,
+                    "tid": thread_ids[span.thread],
+                }
+            )
+        return {"traceEvents": events, "displayTimeUnit": "ms"}
+
+    def writeChromeTrace(self, path):
+        with open(path, "w") as trace_file:
+            json.dump(self.chromeTrace(), trace_file)
@@ -0,0 +1,83 @@
+import os
+import threading
+
+
+class RunpathCreation(object):
+    """Creates the runpaths of the active realizations in a run context in a
+    background thread, and tells which realizations are ready so far.
+
+    libres creates the runpaths one realization at a time in a single call.
+    This assumes that libres writes the forward model jobs file last when
+    it creates a runpath, so a runpath is complete once its jobs file
+    exists. Jobs files left by an earlier run in the same runpaths are
+    removed before the creation starts, so a realization is ready exactly
+    when its jobs file shows up again. File modification times are not
+    used, as they may be truncated to whole seconds and the clock of a
+    network file system need not match the local one.
+    """
+
+    JOBS_FILE = "jobs.json"
+
+    def __init__(self, run_context, create_runpath):
+        self.run_context = run_context
+        self._error = None
+        self._pending = [
+            (iens, run_context[iens].runpath)
+            for iens in range(len(run_context))
+            if run_context.is_active(iens)
+        ]
+        self._ready = []
+        for _, runpath in self._pending:
+            try:
+                os.remove(os.path.join(runpath, RunpathCreation.JOBS_FILE))
+            except OSError:
+                pass  # Not created yet
+        self._thread = threading.Thread(
+            name="ert_runpath_creation", target=self._run, args=(create_runpath,)
+        )
+        self._thread.daemon = True
+        self._thread.start()
+
+    def _run(self, create_runpath):
+        try:
+            create_runpath(self.run_context)
+        except Exception as e:
+            self._error = e
+
+    def activeCount(self):
+        """@rtype: int"""
+        return len(self._ready) + len(self._pending)
+
+    def isDone(self):
+        """@rtype: bool"""
+        return not self._thread.is_alive()
+
+    def wait(self, timeout=None):
+        """Waits for the runpaths to be created, at most @timeout seconds if
+        given. Errors from the creation are raised here.
+        @rtype: ErtRunContext or None if it timed out"""
+        self._thread.join(timeout)
+        if not self.isDone():
+            return None
+
+        if self._error is not None:
+            raise self._error
+        return self.run_context
+
+    def readyRealizations(self):
+        """The realizations whose runpath has been created, in the order they
+        were seen to be ready.
+        @rtype: list of int"""
+        done = self.isDone()
+        pending = []
+        for iens, runpath in self._pending:
+            if done or self._isReady(runpath):
+                self._ready.append(iens)
+            else:
+                pending.append((iens, runpath))
+        self._pending = pending
+        return list(self._ready)
+
+    @staticmethod
+    def _isReady(runpath):
+        return os.path.exists(os.path.join(runpath, RunpathCreation.JOBS_FILE))
@@ -0,0 +1,66 @@
+import os
+import threading
+
+
+class StatusFileWatcher(object):
+    """Keeps track of which forward model status files have changed since
+    they were last parsed, and refreshes the detailed progress of a run model
+    from a background thread while a simulation runs and its detailed
+    progress is watched, see BaseRunModel.watchDetailedProgress.
+
+    A status file is considered changed when its modification time, inode or
+    size differs from when it was last loaded, so only a stat call is needed
+    per runpath on each refresh. Stat is used rather than inotify since the
+    runpaths typically live on network file systems where inotify does not
+    see changes made by the compute nodes.
+    """
+
+    STATUS_FILE = "status.json"
+    POLL_INTERVAL = 1.0
+
+    def __init__(self, refresh, poll_interval=POLL_INTERVAL):
+        self._refresh = refresh
+        self._poll_interval = poll_interval
+        self._signatures = {}
+        self._stop_event = threading.Event()
+        self._thread = None
+
+    def start(self):
+        self._stop_event.clear()
+        self._thread = threading.Thread(
+            name="ert_status_file_watcher", target=self._watch
+        )
+        self._thread.daemon = True
+        self._thread.start()
+
+    def stop(self):
+        self._stop_event.set()
+        if self._thread is not None:
+            self._thread.join()
+            self._thread = None
+
+    def isRunning(self):
+        """@rtype: bool"""
+        return self._thread is not None
+
+    def _watch(self):
+        while not self._stop_event.wait(self._poll_interval):
+            self._refresh()
+
+    def changed(self, runpath):
+        """Returns the signature of the status file in @runpath if it exists
+        and has changed since it was last loaded, otherwise None."""
+        try:
+            stat = os.stat(os.path.join(runpath, self.STATUS_FILE))
+        except OSError:
+            return None
+
+        signature = (stat.st_mtime, stat.st_ino, stat.st_size)
+        if self._signatures.get(runpath) == signature:
+            return None
+        return signature
+
+    def loaded(self, runpath, signature):
+        """Records that the status file in @runpath was parsed when it had
+        @signature."""
+        self._signatures[runpath] = signature
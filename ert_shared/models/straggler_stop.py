@@ -0,0 +1,94 @@
+import logging
+import time
+
+from res.job_queue import JobStatusType
+
+logger = logging.getLogger(__name__)
+
+
+class StragglerStop(object):
+    """Kills the jobs still left on the job queue of a run model
+    @straggler_timeout seconds after enough realizations have succeeded, so
+    that a few slow realizations do not hold up the whole ensemble. What is
+    enough is decided by the MIN_REALIZATIONS of the configuration, and the
+    killed realizations count as failed.
+
+    This is the straggler handling of STOP_LONG_RUNNING, which kills the
+    jobs running much longer than the average of the completed ones once
+    MIN_REALIZATIONS have succeeded, with a fixed timeout instead. check is
+    run as a queue evaluator of the JobQueueRunner, like the
+    STOP_LONG_RUNNING evaluator, and is not used when STOP_LONG_RUNNING is
+    set, see BaseRunModel.runSimpleStep.
+
+    The status counts are taken from the job queue watcher of the model, so
+    this adds no polling of the queue until the jobs are killed.
+    """
+
+    UNFINISHED = (
+        JobStatusType.JOB_QUEUE_NOT_ACTIVE,
+        JobStatusType.JOB_QUEUE_WAITING,
+        JobStatusType.JOB_QUEUE_SUBMITTED,
+        JobStatusType.JOB_QUEUE_PENDING,
+        JobStatusType.JOB_QUEUE_RUNNING,
+        JobStatusType.JOB_QUEUE_UNKNOWN,
+    )
+
+    def __init__(self, model, straggler_timeout):
+        self._model = model
+        self._straggler_timeout = straggler_timeout
+        self._job_queue = None
+        self._sufficient_since = None
+        self._stopped = False
+
+    def check(self, now=None):
+        """Kills the unfinished jobs if enough realizations succeeded at
+        least @straggler_timeout seconds ago. A new job queue starts over.
+        @rtype: list of int with the queue indexes of the killed jobs"""
+        job_queue = self._model._job_queue
+        if job_queue is None:
+            return []
+
+        if job_queue is not self._job_queue:
+            self._job_queue = job_queue
+            self._sufficient_since = None
+            self._stopped = False
+
+        if self._stopped:
+            return []
+
+        if now is None:
+            now = time.time()
+
+        if self._sufficient_since is None:
+            status_counts = self._model.getQueueStatus()
+            succeeded = status_counts.get(JobStatusType.JOB_QUEUE_SUCCESS, 0)
+            if not self._model.haveSufficientRealizations(succeeded):
+                return []
+
+            logger.info(
+                "%d realizations have succeeded, the remaining will be killed "
+                "in %s seconds",
+                succeeded,
+                self._straggler_timeout,
+            )
+            self._sufficient_since = now
+
+        if now - self._sufficient_since < self._straggler_timeout:
+            return []
+
+        with self._model._queue_lock:
+            killed = [
+                queue_index
+                for queue_index in range(len(job_queue))
+                if job_queue.getJobStatus(queue_index) in StragglerStop.UNFINISHED
+            ]
+            for queue_index in killed:
+                job_queue.kill_job(queue_index)
+
+        self._stopped = True
+        if killed:
+            logger.info(
+                "Killed %d straggling realizations after the straggler timeout",
+                len(killed),
+            )
+        return killed
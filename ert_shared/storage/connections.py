@@ -12,6 +12,8 @@ def get_rdb_connection(url, pragma_foreign_keys=True):
     engine = create_engine(url, echo=False)
     if pragma_foreign_keys:
         engine.execute("pragma foreign_keys=on")
+    # Creates only the missing tables, which adds the tables that are newer
+    # than an existing database to it, such as job_statistics
     Entities.metadata.create_all(engine)
     return engine.connect()
 
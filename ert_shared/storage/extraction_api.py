@@ -1,5 +1,7 @@
 import time
 
+import pandas as pd
+
 from ert_data.measured import MeasuredData
 from ert_shared import ERT
 from ert_shared.feature_toggling import feature_enabled
@@ -14,22 +16,18 @@ import logging
 logger = logging.getLogger(__file__)
 
 
-def _create_ensemble(rdb_api, reference, priors):
+def _create_ensemble(rdb_api, ensemble_name, ensemble_size, reference, priors):
     if not ((reference is None) ^ (len(priors) == 0)):
         raise ValueError("Ensembles can have only a reference or a set of priors")
-    facade = ERT.enkf_facade
-    ensemble_name = facade.get_current_case_name()
     ensemble = rdb_api.add_ensemble(ensemble_name, reference=reference, priors=priors)
 
-    for i in range(facade.get_ensemble_size()):
+    for i in range(ensemble_size):
         rdb_api.add_realization(index=i, ensemble_name=ensemble.name)
 
     return ensemble
 
 
-def _extract_and_dump_observations(rdb_api, blob_api):
-    facade = ERT.enkf_facade
-
+def _extract_observations(facade):
     observation_keys = [
         facade.get_observation_key(nr) for nr, _ in enumerate(facade.get_observations())
     ]
@@ -37,9 +35,7 @@ def _extract_and_dump_observations(rdb_api, blob_api):
     measured_data = MeasuredData(facade, observation_keys)
 
     measured_data.remove_inactive_observations()
-    observations = measured_data.data.loc[["OBS", "STD"]]
-
-    _dump_observations(rdb_api=rdb_api, blob_api=blob_api, observations=observations)
+    return measured_data.data.loc[["OBS", "STD"]]
 
 
 def _dump_observations(rdb_api, blob_api, observations):
@@ -66,24 +62,16 @@ def _dump_observations(rdb_api, blob_api, observations):
         )
 
 
-def _extract_and_dump_parameters(rdb_api, blob_api, ensemble_name, priors):
-    facade = ERT.enkf_facade
-
+def _extract_parameters(facade, ensemble_name):
     parameter_keys = [
         key for key in facade.all_data_type_keys() if facade.is_gen_kw_key(key)
     ]
-    all_parameters = {
-        key: facade.gather_gen_kw_data(ensemble_name, key) for key in parameter_keys
+    all_data = facade.gather_all_gen_kw_data(ensemble_name, parameter_keys)
+    return {
+        key: all_data[[key]].dropna() if key in all_data else pd.DataFrame()
+        for key in parameter_keys
     }
 
-    _dump_parameters(
-        rdb_api=rdb_api,
-        blob_api=blob_api,
-        parameters=all_parameters,
-        ensemble_name=ensemble_name,
-        priors=priors,
-    )
-
 
 def _dump_parameters(rdb_api, blob_api, parameters, ensemble_name, priors):
     for key, parameter in parameters.items():
@@ -104,9 +92,8 @@ def _dump_parameters(rdb_api, blob_api, parameters, ensemble_name, priors):
             )
 
 
-def _extract_and_dump_responses(rdb_api, blob_api, ensemble_name):
-    facade = ERT.enkf_facade
-
+def _extract_responses(facade, ensemble_name):
+    """The GEN_DATA and the summary responses, as a dict each"""
     gen_data_keys = [
         key for key in facade.all_data_type_keys() if facade.is_gen_data_key(key)
     ]
@@ -118,23 +105,14 @@ def _extract_and_dump_responses(rdb_api, blob_api, ensemble_name):
         key.split("@")[0]: facade.gather_gen_data_data(case=ensemble_name, key=key)
         for key in gen_data_keys
     }
+    all_summary_data = facade.gather_all_summary_data(
+        case=ensemble_name, keys=summary_data_keys
+    )
     summary_data = {
-        key: facade.gather_summary_data(case=ensemble_name, key=key)
+        key: all_summary_data[key] if key in all_summary_data else pd.DataFrame()
         for key in summary_data_keys
     }
-
-    _dump_response(
-        rdb_api=rdb_api,
-        blob_api=blob_api,
-        responses=gen_data_data,
-        ensemble_name=ensemble_name,
-    )
-    _dump_response(
-        rdb_api=rdb_api,
-        blob_api=blob_api,
-        responses=summary_data,
-        ensemble_name=ensemble_name,
-    )
+    return gen_data_data, summary_data
 
 
 def _dump_response(rdb_api, blob_api, responses, ensemble_name):
@@ -170,19 +148,31 @@ def _extract_active_observations(facade):
     return active_observations
 
 
-def _extract_and_dump_update_data(ensemble_id, ensemble_name, rdb_api, blob_api):
-    facade = ERT.enkf_facade
-
+def _extract_misfits(facade):
+    """The observation key, the response key and the misfit per realization
+    of each observation"""
     fs = facade.get_current_fs()
     realizations = MisfitCollector.createActiveList(ERT.ert, fs)
+    return [
+        (
+            obs_vector.getObservationKey(),
+            obs_vector.getDataKey(),
+            [
+                (realization_number, obs_vector.getTotalChi2(fs, realization_number))
+                for realization_number in realizations
+            ],
+        )
+        for obs_vector in facade.get_observations()
+    ]
+
 
-    active_observations = _extract_active_observations(facade)
+def _dump_update_data(
+    ensemble_id, ensemble_name, rdb_api, blob_api, active_observations, misfits
+):
     ensemble = rdb_api.get_ensemble_by_id(ensemble_id=ensemble_id)
     update_id = ensemble.parent.id if ensemble.parent is not None else None
 
-    for obs_vector in facade.get_observations():
-        observation_key = obs_vector.getObservationKey()
-        response_key = obs_vector.getDataKey()
+    for observation_key, response_key, realization_misfits in misfits:
         response_definition = rdb_api._get_response_definition(
             response_key, ensemble_id
         )
@@ -198,21 +188,64 @@ def _extract_and_dump_update_data(ensemble_id, ensemble_name, rdb_api, blob_api)
             active_ref=active_blob.id if active_observations is not None else None,
             update_id=update_id,
         )
-        for realization_number in realizations:
+        for realization_number, misfit_value in realization_misfits:
             response = rdb_api.get_response(
                 name=response_key,
                 realization_index=realization_number,
                 ensemble_name=ensemble_name,
             )
-            misfit_value = obs_vector.getTotalChi2(fs, realization_number)
             rdb_api._add_misfit(
                 value=misfit_value, link_id=link.id, response_id=response.id
             )
 
 
+class LibresExtraction(object):
+    """Everything stored about a case, read from libres by
+    extract_from_libres"""
+
+    def __init__(self, reference):
+        facade = ERT.enkf_facade
+        self.reference = reference
+        self.priors = facade.gen_kw_priors() if reference is None else {}
+        self.ensemble_name = facade.get_current_case_name()
+        self.ensemble_size = facade.get_ensemble_size()
+        self.observations = _extract_observations(facade)
+        self.parameters = _extract_parameters(facade, self.ensemble_name)
+        self.responses = _extract_responses(facade, self.ensemble_name)
+        self.active_observations = _extract_active_observations(facade)
+        self.misfits = _extract_misfits(facade)
+
+
+@feature_enabled("new-storage")
+def extract_from_libres(reference=None):
+    """Reads the current case from libres, for dump_extraction to store.
+    @reference is the (name, analysis module) of the ensemble it was
+    updated from.
+    @rtype: LibresExtraction"""
+    return LibresExtraction(reference)
+
+
 @feature_enabled("new-storage")
-def dump_to_new_storage(reference=None, rdb_connection=None, blob_connection=None):
+def dump_to_new_storage(
+    reference=None, rdb_connection=None, blob_connection=None, job_statistics=None
+):
+    """Stores the current case, see extract_from_libres and
+    dump_extraction. Returns the name of the stored ensemble."""
+    return dump_extraction(
+        extract_from_libres(reference),
+        rdb_connection=rdb_connection,
+        blob_connection=blob_connection,
+        job_statistics=job_statistics,
+    )
+
 
+@feature_enabled("new-storage")
+def dump_extraction(
+    extraction, rdb_connection=None, blob_connection=None, job_statistics=None
+):
+    """Stores @extraction in the new storage, without using libres, so
+    EnKFMain can be used by another thread meanwhile. Returns the name of
+    the stored ensemble."""
     start_time = time.time()
     logger.debug("Starting extraction...")
     if rdb_connection is None:
@@ -228,21 +261,47 @@ def dump_to_new_storage(reference=None, rdb_connection=None, blob_connection=Non
     blob_api = BlobApi(connection=blob_connection)
 
     with rdb_api, blob_api:
-        priors = _extract_and_dump_priors(rdb_api=rdb_api) if reference is None else []
+        priors = _dump_priors(groups=extraction.priors, rdb_api=rdb_api)
 
-        ensemble = _create_ensemble(rdb_api, reference=reference, priors=priors)
-        _extract_and_dump_observations(rdb_api=rdb_api, blob_api=blob_api)
+        ensemble = _create_ensemble(
+            rdb_api,
+            ensemble_name=extraction.ensemble_name,
+            ensemble_size=extraction.ensemble_size,
+            reference=extraction.reference,
+            priors=priors,
+        )
+        _dump_observations(
+            rdb_api=rdb_api, blob_api=blob_api, observations=extraction.observations
+        )
 
-        _extract_and_dump_parameters(
+        _dump_parameters(
             rdb_api=rdb_api,
             blob_api=blob_api,
+            parameters=extraction.parameters,
             ensemble_name=ensemble.name,
             priors=priors,
         )
-        _extract_and_dump_responses(
-            rdb_api=rdb_api, blob_api=blob_api, ensemble_name=ensemble.name
+        for responses in extraction.responses:
+            _dump_response(
+                rdb_api=rdb_api,
+                blob_api=blob_api,
+                responses=responses,
+                ensemble_name=ensemble.name,
+            )
+        _dump_update_data(
+            ensemble.id,
+            ensemble.name,
+            rdb_api,
+            blob_api,
+            extraction.active_observations,
+            extraction.misfits,
         )
-        _extract_and_dump_update_data(ensemble.id, ensemble.name, rdb_api, blob_api)
+        if job_statistics:
+            _dump_job_statistics(
+                rdb_api=rdb_api,
+                ensemble_name=ensemble.name,
+                job_statistics=job_statistics,
+            )
         blob_api.commit()
         rdb_api.commit()
         ensemble_name = ensemble.name
@@ -263,10 +322,11 @@ def dump_to_new_storage(reference=None, rdb_connection=None, blob_connection=Non
     return ensemble_name
 
 
-def _extract_and_dump_priors(rdb_api):
-    facade = ERT.enkf_facade
-    gen_kw_priors = facade.gen_kw_priors()
-    return _dump_priors(groups=gen_kw_priors, rdb_api=rdb_api)
+def _dump_job_statistics(rdb_api, ensemble_name, job_statistics):
+    for name in sorted(job_statistics):
+        rdb_api.add_job_statistics(
+            name=name, statistics=job_statistics[name], ensemble_name=ensemble_name
+        )
 
 
 def _dump_priors(groups, rdb_api):
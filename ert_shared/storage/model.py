@@ -118,6 +118,38 @@ Ensemble.realizations = relationship(
 )
 
 
+class JobStatistics(Entities):
+    __tablename__ = "job_statistics"
+
+    id = Column(Integer, primary_key=True)
+    name = Column(String)
+    count = Column(Integer)
+    runtime_p50 = Column(Float)
+    runtime_p95 = Column(Float)
+    runtime_max = Column(Float)
+    max_memory_usage_p50 = Column(Float)
+    max_memory_usage_p95 = Column(Float)
+    max_memory_usage_max = Column(Float)
+    ensemble_id = Column(Integer, ForeignKey("ensembles.id"))
+    ensemble = relationship("Ensemble", back_populates="job_statistics")
+
+    __table_args__ = (
+        UniqueConstraint(
+            "name", "ensemble_id", name="_uc_job_statistics_name_ensemble_id_"
+        ),
+    )
+
+    def __repr__(self):
+        return "<JobStatistics(name='{}', count='{}', ensemble_id='{}')>".format(
+            self.name, self.count, self.ensemble_id
+        )
+
+
+Ensemble.job_statistics = relationship(
+    "JobStatistics", order_by=JobStatistics.id, back_populates="ensemble"
+)
+
+
 class ResponseDefinition(Entities):
     __tablename__ = "response_definitions"
 
@@ -13,6 +13,7 @@ from ert_shared.storage.model import (
     ObservationResponseDefinitionLink,
     Misfit,
     ParameterPrior,
+    JobStatistics,
 )
 from sqlalchemy import create_engine, desc
 from sqlalchemy.orm import Bundle
@@ -160,6 +161,30 @@ class RdbApi:
 
         return realization
 
+    def add_job_statistics(self, name, statistics, ensemble_name):
+        msg = "Adding statistics of job '{}' on ensemble '{}'"
+        logger.info(msg.format(name, ensemble_name))
+
+        ensemble = self.get_ensemble(name=ensemble_name)
+
+        runtime = statistics["runtime"]
+        max_memory_usage = statistics["max_memory_usage"]
+        job_statistics = JobStatistics(
+            name=name,
+            count=statistics["count"],
+            runtime_p50=runtime["p50"],
+            runtime_p95=runtime["p95"],
+            runtime_max=runtime["max"],
+            max_memory_usage_p50=max_memory_usage["p50"],
+            max_memory_usage_p95=max_memory_usage["p95"],
+            max_memory_usage_max=max_memory_usage["max"],
+        )
+        ensemble.job_statistics.append(job_statistics)
+
+        self._session.add(job_statistics)
+
+        return job_statistics
+
     def add_response_definition(
         self, name, indexes_ref, ensemble_name,
     ):
@@ -356,6 +381,9 @@ class RdbApi:
             ensemble_id=ensemble_id
         )
 
+    def get_job_statistics_by_ensemble_id(self, ensemble_id):
+        return self._session.query(JobStatistics).filter_by(ensemble_id=ensemble_id)
+
     def get_response_by_realization_id(self, response_definition_id, realization_id):
         return (
             self._session.query(Response)
@@ -1,3 +1,4 @@
+import logging
 import time
 
 from res.job_queue import JobStatusType
@@ -6,14 +7,29 @@ from ert_shared.tracker.events import DetailedEvent, EndEvent, GeneralEvent, Tic
 from ert_shared.tracker.state import SimulationStateStatus
 from ert_shared.tracker.utils import calculate_progress
 
+logger = logging.getLogger(__name__)
+
+GENERAL = "general"
+DETAILED = "detailed"
+
 
 class BaseTracker(object):
-    """BaseTracker provides the basis for doing tracking."""
+    """BaseTracker provides the basis for doing tracking.
+
+    The wall time of the general and detailed updates is measured, and the
+    trackers stretch their intervals so that these updates together use at
+    most @max_poll_fraction of the consumer's time, half of it each."""
+
+    MAX_POLL_FRACTION = 0.1
 
-    def __init__(self, model):
+    def __init__(self, model, max_poll_fraction=MAX_POLL_FRACTION):
         """Initialize the tracker for a @model. A model can be any
         BaseRunModel-derived class."""
         self._model = model
+        self._max_poll_fraction = max_poll_fraction
+        self._poll_costs = {}
+        self._last_polls = {}
+        self._intervals = {}
 
         self._states = []
         self._custom_states = []
@@ -26,6 +42,9 @@ class BaseTracker(object):
         #       see https://github.com/equinor/ert/issues/556
         self._phase_states = {}
 
+        # sequence number of the last detailed progress change seen
+        self._detailed_sequence = 0
+
     def _bootstrap_states(self):
         waiting_flag = (
             JobStatusType.JOB_QUEUE_NOT_ACTIVE
@@ -116,11 +135,12 @@ class BaseTracker(object):
         phase = self._model.currentPhase()
         phase_count = self._model.phaseCount()
         queue_status = self._model.getQueueStatus()
+        queue_size = self._model.getQueueSize()
 
         done_count = 0
         for state in self.get_states():
             state.count = 0
-            state.total_count = self._model.getQueueSize()
+            state.total_count = queue_size
 
             for queue_state in queue_status:
                 if queue_state in state.state:
@@ -134,7 +154,7 @@ class BaseTracker(object):
             phase_count,
             self._model.isFinished(),
             self._model.isQueueRunning(),
-            self._model.getQueueSize(),
+            queue_size,
             self._phase_states[phase],
             done_count,
         )
@@ -148,11 +168,72 @@ class BaseTracker(object):
             self._model.isIndeterminate(),
             self.get_states(),
             tick.runtime,
+            self._model.getJobStatistics(),
+            self._model.getStragglers(),
         )
 
     def _detailed_event(self):
+        """A DetailedEvent with a snapshot of the progress of every
+        realization."""
         return DetailedEvent(*self._model.getDetailedProgress())
 
+    def _detailed_delta_event(self):
+        """A DetailedEvent with the progress of the realizations that changed
+        since the previous delta event. The first one after a reset holds all
+        realizations."""
+        changes, iteration, sequence = self._model.getDetailedProgressChanges(
+            self._detailed_sequence
+        )
+        self._detailed_sequence = sequence
+        return DetailedEvent(changes, iteration, sequence, delta=True)
+
+    def snapshot(self):
+        """ @rtype: DetailedEvent """
+        return self._detailed_event()
+
+    def _measure(self, kind, create_event):
+        """Creates an event with @create_event and records the time it took
+        as the cost of a @kind update. The cost is smoothed over the last few
+        updates."""
+        start = time.time()
+        event = create_event()
+        self._last_polls[kind] = time.time()
+        cost = self._last_polls[kind] - start
+
+        previous = self._poll_costs.get(kind)
+        self._poll_costs[kind] = cost if previous is None else (previous + cost) / 2.0
+        logger.debug("Tracker {} update took {:.3f} seconds".format(kind, cost))
+        return event
+
+    def _min_poll_interval(self, kind):
+        """The shortest interval in seconds between @kind updates that keeps
+        them within their share of the polling budget."""
+        return self._poll_costs.get(kind, 0.0) / (self._max_poll_fraction / 2.0)
+
+    def _adapted_interval(self, kind, interval):
+        """Returns @interval, or a longer one if @kind updates are too costly
+        to be made that often."""
+        if interval <= 0:
+            return interval
+
+        adapted = max(interval, self._min_poll_interval(kind))
+        if round(adapted, 1) != round(self._intervals.get(kind, interval), 1):
+            logger.debug(
+                "Tracker {} interval set to {:.1f} seconds, update cost is {:.3f} seconds".format(
+                    kind, adapted, self._poll_costs.get(kind, 0.0)
+                )
+            )
+        self._intervals[kind] = adapted
+        return adapted
+
+    def _poll_delay(self, kind):
+        """Seconds to wait before a @kind update can be made outside of its
+        interval without exceeding its share of the polling budget."""
+        last_poll = self._last_polls.get(kind)
+        if last_poll is None:
+            return 0.0
+        return max(0.0, last_poll + self._min_poll_interval(kind) - time.time())
+
     def _end_event(self):
         return EndEvent(self._model.hasRunFailed(), self._model.getFailMessage())
 
@@ -178,3 +259,4 @@ class BaseTracker(object):
 
     def reset(self):
         self._phase_states = {}
+        self._detailed_sequence = 0
@@ -1,32 +1,85 @@
+import math
 import time
 
-from ert_shared.tracker.base import BaseTracker
+try:
+    from queue import Empty
+except ImportError:
+    from Queue import Empty
+
+from ert_shared.tracker.base import DETAILED, GENERAL, BaseTracker
 
 
 class BlockingTracker(BaseTracker):
     """The BlockingTracker provide tracking for non-qt consumers."""
 
-    def __init__(self, model, tick_interval, general_interval, detailed_interval):
+    def __init__(
+        self,
+        model,
+        tick_interval,
+        general_interval,
+        detailed_interval,
+        max_poll_fraction=BaseTracker.MAX_POLL_FRACTION,
+    ):
         """See create_tracker for details."""
-        super(BlockingTracker, self).__init__(model)
+        super(BlockingTracker, self).__init__(model, max_poll_fraction)
         self._tick_interval = tick_interval
         self._general_interval = general_interval
         self._detailed_interval = detailed_interval
 
     def track(self):
         """Tracks the model in a blocking manner. This method is a generator
-        and will yield events at the appropriate times."""
+        and will yield events at the appropriate times.
+
+        Between ticks the tracker waits for state changes published by the
+        model. A job status transition or phase change yields a GeneralEvent
+        right away, or as soon as the polling budget allows, instead of at
+        the next general interval. Completion of the model ends tracking
+        without waiting for the tick."""
+        state_changes = self._model.subscribe()
+        try:
+            for event in self._track(state_changes):
+                yield event
+        finally:
+            self._model.unsubscribe(state_changes)
+
+    def _track(self, state_changes):
         tick = 0
+        next_general = 0
+        next_detailed = 0
+        changed = False
         while not self._model.isFinished():
             if self._tick_interval and tick % self._tick_interval == 0:
                 yield self._tick_event()
-            if self._general_interval and tick % self._general_interval == 0:
-                yield self._general_event()
-            if self._detailed_interval and tick % self._detailed_interval == 0:
-                yield self._detailed_event()
+            if self._general_interval and (
+                tick >= next_general or (changed and self._poll_delay(GENERAL) == 0)
+            ):
+                yield self._measure(GENERAL, self._general_event)
+                next_general = tick + self._interval_ticks(
+                    GENERAL, self._general_interval
+                )
+                changed = False
+            if self._detailed_interval and tick >= next_detailed:
+                yield self._measure(DETAILED, self._detailed_delta_event)
+                next_detailed = tick + self._interval_ticks(
+                    DETAILED, self._detailed_interval
+                )
 
             tick += 1
-            time.sleep(1)
+            next_tick = time.time() + 1
+            while self._wait_for_state_change(state_changes, next_tick):
+                if self._model.isFinished():
+                    break
+                changed = True
+                if not self._general_interval:
+                    continue
+
+                # Changes that come too soon after the previous update are
+                # delayed to stay within the polling budget
+                delay = self._poll_delay(GENERAL)
+                if time.time() + delay < next_tick:
+                    time.sleep(delay)
+                    yield self._measure(GENERAL, self._general_event)
+                    changed = False
 
         # Simulation done, emit final updates
         if self._tick_interval > 0:
@@ -36,9 +89,33 @@ class BlockingTracker(BaseTracker):
             yield self._general_event()
 
         if self._detailed_interval > 0:
-            yield self._detailed_event()
+            yield self._detailed_delta_event()
 
         yield self._end_event()
 
+    def _interval_ticks(self, kind, interval):
+        return int(math.ceil(self._adapted_interval(kind, interval)))
+
+    @staticmethod
+    def _wait_for_state_change(state_changes, deadline):
+        """Blocks until the model publishes a state change or @deadline is
+        reached. All pending state changes are consumed, so a burst of
+        transitions results in a single update. Returns whether anything
+        changed."""
+        timeout = deadline - time.time()
+        if timeout <= 0:
+            return False
+
+        try:
+            state_changes.get(timeout=timeout)
+        except Empty:
+            return False
+
+        while True:
+            try:
+                state_changes.get_nowait()
+            except Empty:
+                return True
+
     def stop(self):
         raise NotImplementedError("cannot stop BlockingTracker")
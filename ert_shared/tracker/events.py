@@ -13,6 +13,8 @@ class GeneralEvent(object):
         indeterminate,
         sim_states,
         runtime,
+        job_statistics=None,
+        stragglers=None,
     ):
         self.phase_name = phase_name
         self.current_phase = current_phase
@@ -21,15 +23,46 @@ class GeneralEvent(object):
         self.indeterminate = indeterminate
         self.sim_states = sim_states
         self.runtime = runtime
+        # forward model job name -> runtime and memory usage statistics, see
+        # BaseRunModel.getJobStatistics
+        self.job_statistics = job_statistics
+        # queue index -> seconds running, for the jobs running much longer
+        # than the completed ones, see BaseRunModel.getStragglers
+        self.stragglers = stragglers or {}
 
 
 class DetailedEvent(object):
-    def __init__(self, details, iteration):
+    def __init__(self, details, iteration, sequence=None, delta=False):
+        # If delta is set, details only holds the realizations that changed
+        # since the DetailedEvent with the previous sequence number.
         self.details = details
         self.iteration = iteration
+        self.sequence = sequence
+        self.delta = delta
 
 
 class EndEvent(object):
     def __init__(self, failed, failed_msg=None):
         self.failed = failed
         self.failed_msg = failed_msg
+
+
+class PhaseChangeEvent(object):
+    def __init__(self, phase, phase_name, finished):
+        self.phase = phase
+        self.phase_name = phase_name
+        self.finished = finished
+
+
+class JobStatusChangeEvent(object):
+    def __init__(self, changes):
+        # queue index -> (previous status, new status)
+        self.changes = changes
+
+
+class StragglerEvent(object):
+    def __init__(self, stragglers, runtime_limit):
+        # queue index -> seconds running, for the jobs running for longer
+        # than runtime_limit seconds
+        self.stragglers = stragglers
+        self.runtime_limit = runtime_limit
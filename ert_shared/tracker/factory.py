@@ -1,3 +1,4 @@
+from ert_shared.tracker.base import BaseTracker
 from ert_shared.tracker.blocking import BlockingTracker
 from ert_shared.tracker.qt import QTimerTracker
 from ert_shared.tracker.utils import scale_intervals
@@ -11,6 +12,8 @@ def create_tracker(
     qtimer_cls=None,
     event_handler=None,
     num_realizations=None,
+    max_poll_fraction=BaseTracker.MAX_POLL_FRACTION,
+    state_change_signal=None,
 ):
     """Creates a tracker tracking a @model. The provided model
     is updated in three tiers: @tick_interval,
@@ -18,11 +21,18 @@ def create_tracker(
     interval to <=0 disables update.
 
     Should a @qtimer_cls be defined, the Qt event loop will be used for
-    tracking. @event_handler must then be defined.
+    tracking. @event_handler must then be defined, and the state changes of
+    the model are followed as they happen if a @state_change_signal is given;
+    a Qt signal of an object living on the event loop.
 
     If @num_realizations is defined, then the intervals are scaled
     according to some affine transformation such that it is tractable to
     do tracking.
+
+    The general and detailed intervals are lower bounds: the trackers
+    measure how long these updates take and lengthen the intervals so that
+    they use at most @max_poll_fraction of the consumer's time. The measured
+    costs are logged.
     """
     if num_realizations is not None:
         general_interval, detailed_interval = scale_intervals(num_realizations)
@@ -39,9 +49,11 @@ def create_tracker(
             general_interval,
             detailed_interval,
             event_handler,
+            max_poll_fraction,
+            state_change_signal,
         )
     else:
         tracker = BlockingTracker(
-            model, tick_interval, general_interval, detailed_interval
+            model, tick_interval, general_interval, detailed_interval, max_poll_fraction
         )
     return tracker
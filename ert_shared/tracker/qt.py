@@ -1,9 +1,31 @@
-from ert_shared.tracker.base import BaseTracker
+from ert_shared.tracker.base import DETAILED, GENERAL, BaseTracker
+
+
+class _StateChangeSignal(object):
+    """Subscribes to a model in place of a queue, and emits @signal for
+    every state change published instead of keeping it."""
+
+    def __init__(self, signal):
+        self._signal = signal
+
+    def put(self, event):
+        self._signal.emit()
 
 
 class QTimerTracker(BaseTracker):
     """The QTimerTracker provide tracking for Qt-based consumers using
-    QTimer."""
+    QTimer.
+
+    In addition to the interval timers, the state changes published by the
+    model emit @state_change_signal, if given, so job status transitions and
+    phase changes are shown without waiting for the next general update.
+    The signal is emitted from the thread publishing the change, and Qt
+    queues the resulting update on the event loop of the consumer.
+
+    The general and detailed timers are slowed down if their updates take
+    too long, see BaseTracker. With detailed updates, the tracker watches the
+    detailed progress of the model while tracking, so that the status files
+    are read in the background, see BaseRunModel.watchDetailedProgress."""
 
     def __init__(
         self,
@@ -13,11 +35,20 @@ class QTimerTracker(BaseTracker):
         general_interval,
         detailed_interval,
         event_handler,
+        max_poll_fraction=BaseTracker.MAX_POLL_FRACTION,
+        state_change_signal=None,
     ):
         """See create_tracker for details."""
-        super(QTimerTracker, self).__init__(model)
+        super(QTimerTracker, self).__init__(model, max_poll_fraction)
         self._qtimers = []
         self._event_handler = event_handler
+        self._general_interval = general_interval
+        self._detailed_interval = detailed_interval
+        self._general_timer = None
+        self._detailed_timer = None
+        self._state_change_signal = state_change_signal
+        self._state_changes = None
+        self._watching_details = False
 
         if tick_interval <= 0:
             raise ValueError(
@@ -35,12 +66,41 @@ class QTimerTracker(BaseTracker):
             timer.setInterval(general_interval * 1000)
             timer.timeout.connect(self._general)
             self._qtimers.append(timer)
+            self._general_timer = timer
 
         if detailed_interval > 0:
             timer = qtimer_cls()
             timer.setInterval(detailed_interval * 1000)
             timer.timeout.connect(self._detailed)
             self._qtimers.append(timer)
+            self._detailed_timer = timer
+
+        # Runs a state change update that was put off by the polling budget
+        self._deferred_state_change = qtimer_cls()
+        self._deferred_state_change.setSingleShot(True)
+        self._deferred_state_change.timeout.connect(self._state_change)
+
+        if state_change_signal is not None:
+            state_change_signal.connect(self._state_change)
+
+    def _state_change(self):
+        if self._state_changes is None:
+            return
+
+        if self._model.isFinished():
+            self._deferred_state_change.stop()
+            self._tick()
+        elif self._general_interval <= 0:
+            return
+        elif self._deferred_state_change.isActive():
+            # An update is already planned, and will include this change
+            return
+        else:
+            delay = self._poll_delay(GENERAL)
+            if delay == 0:
+                self._general()
+            else:
+                self._deferred_state_change.start(int(delay * 1000) + 1)
 
     def _tick(self):
         self._event_handler(self._tick_event())
@@ -55,18 +115,46 @@ class QTimerTracker(BaseTracker):
             self.stop()
 
     def _general(self):
-        self._event_handler(self._general_event())
+        self._event_handler(self._measure(GENERAL, self._general_event))
+        self._adapt_timer(self._general_timer, GENERAL, self._general_interval)
 
     def _detailed(self):
-        self._event_handler(self._detailed_event())
+        self._event_handler(self._measure(DETAILED, self._detailed_delta_event))
+        self._adapt_timer(self._detailed_timer, DETAILED, self._detailed_interval)
+
+    def _adapt_timer(self, timer, kind, interval):
+        if timer is None:
+            return
+
+        adapted_interval = int(self._adapted_interval(kind, interval) * 1000)
+        if adapted_interval != timer.interval():
+            timer.setInterval(adapted_interval)
 
     def _end(self):
         self._event_handler(self._end_event())
 
     def track(self):
+        if self._detailed_timer is not None and not self._watching_details:
+            self._model.watchDetailedProgress()
+            self._watching_details = True
+
+        if self._state_changes is None and self._state_change_signal is not None:
+            self._state_changes = self._model.subscribe(
+                _StateChangeSignal(self._state_change_signal)
+            )
+
         for timer in self._qtimers:
             timer.start()
 
     def stop(self):
+        self._deferred_state_change.stop()
+        if self._watching_details:
+            self._model.unwatchDetailedProgress()
+            self._watching_details = False
+
+        if self._state_changes is not None:
+            self._model.unsubscribe(self._state_changes)
+            self._state_changes = None
+
         for timer in self._qtimers:
             timer.stop()
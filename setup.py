@@ -24,6 +24,7 @@ setup(
         "ert_data",
         "ert_logging",
         "ert_shared",
+        "ert_shared.export",
         "ert_shared.models",
         "ert_shared.plugins",
         "ert_shared.plugins.hook_specifications",
@@ -7,6 +7,7 @@ from ert_shared.cli import (
     ENSEMBLE_SMOOTHER_MODE,
     ENSEMBLE_EXPERIMENT_MODE,
     ES_MDA_MODE,
+    EXPORT_MODE,
     TEST_RUN_MODE,
     WORKFLOW_MODE,
 )
@@ -44,6 +45,45 @@ def test_argparse_exec_test_run_valid_case():
     assert parsed.func.__name__ == "run_cli"
 
 
+def test_argparse_exec_test_run_event_feed():
+    parsed = ert_parser(
+        None,
+        [TEST_RUN_MODE, "--event-feed", "tcp://localhost:5000", "path/to/config.ert"],
+    )
+    assert parsed.event_feed == "tcp://localhost:5000"
+    assert ert_parser(None, [TEST_RUN_MODE, "path/to/config.ert"]).event_feed is None
+
+
+def test_argparse_exec_test_run_timeline():
+    parsed = ert_parser(
+        None, [TEST_RUN_MODE, "--timeline", "trace.json", "path/to/config.ert"]
+    )
+    assert parsed.timeline == "trace.json"
+    assert ert_parser(None, [TEST_RUN_MODE, "path/to/config.ert"]).timeline is None
+
+
+def test_argparse_event_feed_conflicts_with_disabled_monitoring():
+    with pytest.raises(SystemExit):
+        ert_parser(
+            None,
+            [
+                TEST_RUN_MODE,
+                "--disable-monitoring",
+                "--event-feed",
+                "feed.json",
+                "path/to/config.ert",
+            ],
+        )
+
+
+@pytest.mark.parametrize("mode", [WORKFLOW_MODE, EXPORT_MODE])
+def test_argparse_event_feed_and_timeline_only_for_simulations(mode):
+    with pytest.raises(SystemExit):
+        ert_parser(None, [mode, "--event-feed", "feed.json", "x", "config.ert"])
+    with pytest.raises(SystemExit):
+        ert_parser(None, [mode, "--timeline", "trace.json", "x", "config.ert"])
+
+
 def test_argparse_exec_ensemble_experiment_valid_case():
     parsed = ert_parser(
         None,
@@ -117,9 +157,27 @@ def test_argparse_exec_es_mda_default_weights():
     parsed = ert_parser(None, [ES_MDA_MODE, "path/to/config.ert"])
     assert parsed.mode == ES_MDA_MODE
     assert parsed.weights == "4, 2, 1"
+    assert not parsed.pipelined
+    assert parsed.straggler_timeout is None
     assert parsed.func.__name__ == "run_cli"
 
 
+def test_argparse_exec_es_mda_pipelined():
+    parsed = ert_parser(None, [ES_MDA_MODE, "--pipelined", "path/to/config.ert"])
+    assert parsed.mode == ES_MDA_MODE
+    assert parsed.pipelined
+
+
+def test_argparse_exec_es_mda_straggler_timeout():
+    parsed = ert_parser(
+        None, [ES_MDA_MODE, "--straggler-timeout", "600", "path/to/config.ert"]
+    )
+    assert parsed.straggler_timeout == 600
+
+    with pytest.raises(SystemExit):
+        ert_parser(None, [ES_MDA_MODE, "--straggler-timeout", "-1", "config.ert"])
+
+
 def test_argparse_exec_ensemble_es_mda_current_case():
     parsed = ert_parser(
         None, [ES_MDA_MODE, "--current-case", "test_case", "path/to/config.ert"]
@@ -136,6 +194,38 @@ def test_argparse_exec_workflow():
     assert parsed.func.__name__ == "run_cli"
 
 
+def test_argparse_exec_export():
+    parsed = ert_parser(
+        None,
+        [
+            EXPORT_MODE,
+            "PORO",
+            "--case",
+            "default",
+            "--realizations",
+            "0-9",
+            "--file-type",
+            "roff",
+            "--workers",
+            "4",
+            "path/to/config.ert",
+        ],
+    )
+    assert parsed.mode == EXPORT_MODE
+    assert parsed.keyword == "PORO"
+    assert parsed.case == "default"
+    assert parsed.realizations == "0-9"
+    assert parsed.file_type == "roff"
+    assert parsed.workers == 4
+    assert parsed.path == "export"
+    assert parsed.func.__name__ == "run_cli"
+
+    with pytest.raises(SystemExit):
+        ert_parser(None, [EXPORT_MODE, "PORO", "--file-type", "csv", "config.ert"])
+    with pytest.raises(SystemExit):
+        ert_parser(None, [EXPORT_MODE, "PORO", "--realizations", "1~4,", "config.ert"])
+
+
 def test_argparse_exec_ensemble_smoother_current_case():
     parsed = ert_parser(
         None,
@@ -0,0 +1,153 @@
+import json
+import sys
+from argparse import Namespace
+
+import pytest
+
+from ert_shared.cli import ENSEMBLE_EXPERIMENT_MODE
+from ert_shared.cli.event_feed import EventFeed
+from ert_shared.cli.main import run_cli
+from ert_shared.tracker.events import DetailedEvent, EndEvent, GeneralEvent
+from ert_shared.tracker.state import SimulationStateStatus
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import Mock, patch
+else:
+    from mock import Mock, patch
+
+if sys.version_info >= (3, 5):
+    from io import StringIO
+else:
+    from io import BytesIO as StringIO
+
+
+def _job(name, status):
+    job = Mock()
+    job.status = status
+    job.dump_data.return_value = {"name": name, "status": status}
+    return job
+
+
+def _records(out):
+    return [json.loads(line) for line in out.getvalue().splitlines()]
+
+
+def test_general_and_end_events():
+    out = StringIO()
+    feed = EventFeed(out)
+    state = SimulationStateStatus("Finished", None, None)
+    state.count = 2
+    state.total_count = 4
+
+    feed.write(GeneralEvent("Running", 0, 1, 0.5, False, [state], 10))
+    feed.write(EndEvent(False))
+
+    general, end = _records(out)
+    assert general["type"] == "GeneralEvent"
+    assert general["progress"] == 0.5
+    assert general["states"] == {"Finished": {"count": 2, "total_count": 4}}
+    assert general["stragglers"] == {}
+    assert end == {"type": "EndEvent", "failed": False, "failed_msg": None}
+
+
+def test_stragglers_are_written():
+    out = StringIO()
+    feed = EventFeed(out)
+
+    feed.write(GeneralEvent("Running", 0, 1, 0.5, False, [], 10, None, {3: 500.0}))
+
+    (general,) = _records(out)
+    assert general["stragglers"] == {"3": 500.0}
+
+
+def test_write_errors_disable_the_feed():
+    out = Mock()
+    out.write.side_effect = IOError("Broken pipe")
+    feed = EventFeed(out)
+
+    feed.write(EndEvent(False))
+    feed.write(EndEvent(False))
+
+    out.write.assert_called_once()
+
+
+def test_job_statistics_are_written_when_changed():
+    out = StringIO()
+    feed = EventFeed(out)
+    statistics = {
+        "ECLIPSE100": {
+            "count": 1,
+            "runtime": {"max": 10.0, "p50": 10.0, "p95": 10.0},
+            "max_memory_usage": {"max": 2e9, "p50": 2e9, "p95": 2e9},
+        }
+    }
+
+    feed.write(GeneralEvent("Running", 0, 1, 0.1, False, [], 1))
+    feed.write(GeneralEvent("Running", 0, 1, 0.5, False, [], 10, statistics))
+    feed.write(GeneralEvent("Running", 0, 1, 0.6, False, [], 11, dict(statistics)))
+
+    records = _records(out)
+    assert [record["type"] for record in records] == [
+        "GeneralEvent",
+        "GeneralEvent",
+        "JobStatistics",
+        "GeneralEvent",
+    ]
+    assert records[2]["jobs"] == statistics
+
+
+def test_detailed_events_only_include_changed_realizations():
+    out = StringIO()
+    feed = EventFeed(out)
+    progress = {
+        0: {
+            0: ([_job("job1", "Running")], "JOB_QUEUE_RUNNING"),
+            1: ([_job("job1", "Waiting")], "JOB_QUEUE_RUNNING"),
+        }
+    }
+
+    feed.write(DetailedEvent(progress, 0, 2, delta=True))
+    feed.write(DetailedEvent(progress, 0, 2, delta=True))
+    progress[0][1] = ([_job("job1", "Success")], "JOB_QUEUE_SUCCESS")
+    feed.write(DetailedEvent(progress, 0, 3, delta=True))
+
+    first, second = _records(out)
+    assert sorted(first["realizations"]["0"]) == ["0", "1"]
+    assert second["sequence"] == 3
+    assert second["realizations"] == {
+        "0": {
+            "1": {
+                "status": "JOB_QUEUE_SUCCESS",
+                "jobs": [{"name": "job1", "status": "Success"}],
+            }
+        }
+    }
+
+
+@patch("ert_shared.cli.main.threading.Thread")
+@patch("ert_shared.cli.main.open_event_stream", side_effect=IOError("Refused"))
+@patch("ert_shared.cli.main.create_model", return_value=(Mock(), {}))
+@patch("ert_shared.cli.main.ERT", Mock())
+@patch("ert_shared.cli.main.ErtCliNotifier", Mock())
+@patch("ert_shared.cli.main.EnKFMain", Mock())
+@patch("ert_shared.cli.main.ResConfig", Mock())
+@patch("ert_shared.cli.main.os.chdir", Mock())
+def test_unusable_event_feed_fails_before_simulations_start(
+    create_model, open_event_stream, thread
+):
+    args = Namespace(
+        config="config.ert",
+        verbose=False,
+        mode=ENSEMBLE_EXPERIMENT_MODE,
+        disable_monitoring=False,
+        color_always=False,
+        event_feed="tcp://localhost:0",
+    )
+
+    with pytest.raises(SystemExit) as exit_info:
+        run_cli(args)
+
+    assert "Refused" in str(exit_info.value)
+    thread.assert_not_called()
+    model, _ = create_model.return_value
+    model.startSimulations.assert_not_called()
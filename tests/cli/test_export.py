@@ -0,0 +1,43 @@
+import sys
+from argparse import Namespace
+
+from ert_shared.cli import export
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import patch
+else:
+    from mock import patch
+
+
+def _args(realizations):
+    return Namespace(
+        keyword="PORO",
+        case="default",
+        realizations=realizations,
+        path="export",
+        file_type=None,
+        report_step=0,
+        workers=None,
+    )
+
+
+@patch.object(export, "ExportModel")
+@patch.object(export, "ERT")
+def test_realizations_outside_the_ensemble_are_an_error(ert, export_model):
+    ert.enkf_facade.get_ensemble_size.return_value = 10
+
+    assert not export.execute_export(_args("5-10"))
+    export_model.assert_not_called()
+
+
+@patch.object(export, "BoolVector")
+@patch.object(export, "ExportModel")
+@patch.object(export, "ERT")
+def test_all_realizations_are_exported_by_default(ert, export_model, bool_vector):
+    ert.enkf_facade.get_ensemble_size.return_value = 10
+    export_model.return_value.createExport.return_value.wait.return_value = True
+    export_model.return_value.createExport.return_value.failed.return_value = {}
+    export_model.return_value.createExport.return_value.isCancelled.return_value = False
+
+    assert export.execute_export(_args(None))
+    bool_vector.return_value.updateActiveMask.assert_called_once_with("0-9")
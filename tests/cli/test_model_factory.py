@@ -142,11 +142,13 @@ class ModelFactoryTest(ErtTest):
 
             model, argument = model_factory._setup_multiple_data_assimilation(args)
             self.assertTrue(isinstance(model, MultipleDataAssimilation))
-            self.assertEqual(4, len(argument.keys()))
+            self.assertEqual(6, len(argument.keys()))
             self.assertTrue("active_realizations" in argument)
             self.assertTrue("target_case" in argument)
             self.assertTrue("analysis_module" in argument)
             self.assertTrue("weights" in argument)
+            self.assertFalse(argument["pipelined"])
+            self.assertIsNone(argument["straggler_timeout"])
             model.create_context(argument, 0)
 
     def test_analysis_module_name_iterable(self):
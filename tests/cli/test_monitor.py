@@ -1,11 +1,16 @@
 # -*- coding: utf-8 -*-
 import sys
 import unittest
-from ert_shared.tracker.events import GeneralEvent
+from ert_shared.tracker.events import EndEvent, GeneralEvent
 from ert_shared.tracker.state import SimulationStateStatus
 from ert_shared.cli.monitor import Monitor
 
 
+if sys.version_info >= (3, 3):
+    from unittest.mock import Mock
+else:
+    from mock import Mock
+
 if sys.version_info >= (3, 5):
     from io import StringIO
 else:
@@ -72,3 +77,26 @@ class MonitorTest(unittest.TestCase):
     Finished       10/100
     Waiting           0/1
 """, out.getvalue())
+
+    def test_print_progress_with_stragglers(self):
+        out = StringIO()
+        monitor = Monitor(out=out)
+        general_event = GeneralEvent("Test Phase", 0, 2, 0.5, False, [], 10,
+                                     stragglers={3: 500.0, 7: 450.0})
+
+        monitor._print_progress(general_event)
+
+        self.assertIn(
+            "2 straggling jobs running much longer than the completed ones",
+            out.getvalue())
+
+    def test_events_are_written_to_event_feed(self):
+        event_feed = Mock()
+        tracker = Mock()
+        end_event = EndEvent(False)
+        tracker.track.return_value = iter([end_event])
+        monitor = Monitor(out=StringIO(), event_feed=event_feed)
+
+        monitor.monitor(tracker)
+
+        event_feed.write.assert_called_once_with(end_event)
@@ -120,3 +120,94 @@ def test_load_summary_data(facade, monkeypatch):
         ANY, facade, observation_key, data_key, case_name
     )
     assert result.equals(create_expected_data())
+
+
+def test_get_block_measured():
+    block_data = {nr: [float(nr), float(nr) + 0.5] for nr in range(3)}
+
+    result = loader._get_block_measured(3, block_data)
+
+    expected = pd.DataFrame(data=[[0.0, 0.5], [1.0, 1.5], [2.0, 2.5]], index=[0, 1, 2])
+    assert result.equals(expected)
+
+
+@pytest.mark.usefixtures("facade")
+def test_load_block_data_multiple_report_steps(facade):
+    facade.get_observations()[
+        "some_key"
+    ].getStepList.return_value.asList.return_value = [1, 2]
+    plot_block_data_loader = Mock()
+    facade.create_plot_block_data_loader.return_value = plot_block_data_loader
+    plot_block_data_loader.load.return_value = {
+        nr: [10.0 + nr, 20.0 + nr] for nr in range(3)
+    }
+    plot_block_data_loader.getBlockObservation.return_value = MockedBlockObservation(
+        {"values": [10.0, 20.0], "stds": [1.0, 2.0]}
+    )
+
+    result = loader.load_block_data(facade, "some_key", "a_random_name")
+
+    assert list(result.index) == ["OBS", "STD", 0, 1, 2] * 2
+    assert result.loc["OBS"].values.tolist() == [[10.0, 20.0], [10.0, 20.0]]
+    assert result.loc[2].values.tolist() == [[12.0, 22.0], [12.0, 22.0]]
+
+
+@pytest.mark.usefixtures("facade")
+def test_load_summary_observations_only(facade):
+    facade.get_observation_index.return_value = {
+        "some_key": Mock(
+            values=[10.0, 20.0],
+            stds=[1.0, 2.0],
+            key_indexes=[pd.Timestamp("2010-01-01"), pd.Timestamp("2010-01-02")],
+        )
+    }
+
+    result = loader.load_summary_data(
+        facade, "some_key", "a_random_name", include_data=False
+    )
+
+    expected = pd.DataFrame(
+        [[10.0, 20.0], [1.0, 2.0]],
+        index=["OBS", "STD"],
+        columns=pd.to_datetime(["2010-01-01", "2010-01-02"]),
+    )
+    assert result.equals(expected)
+    facade.load_observation_data.assert_not_called()
+    facade.load_all_summary_data.assert_not_called()
+
+
+@pytest.mark.parametrize("ensemble_size", [10, 100, 1000])
+@pytest.mark.usefixtures("facade")
+def test_load_block_data_copies_each_row_once(facade, monkeypatch, ensemble_size):
+    # Appending the blocks one at a time copied everything loaded so far, so
+    # the rows copied grew with the square of the ensemble size times the
+    # number of report steps. Counting the rows handed to pandas keeps this
+    # deterministic, where wall-clock timing of these small mocked frames is
+    # dominated by per-step overhead and noise.
+    report_steps = 20
+    facade.get_ensemble_size.return_value = ensemble_size
+    facade.get_observations()[
+        "some_key"
+    ].getStepList.return_value.asList.return_value = list(range(report_steps))
+    plot_block_data_loader = Mock()
+    facade.create_plot_block_data_loader.return_value = plot_block_data_loader
+    plot_block_data_loader.load.return_value = {
+        nr: [float(nr)] * 5 for nr in range(ensemble_size)
+    }
+    plot_block_data_loader.getBlockObservation.return_value = MockedBlockObservation(
+        {"values": [1.0] * 5, "stds": [0.1] * 5}
+    )
+    copied_rows = []
+    concat = pd.concat
+
+    def counting_concat(frames, *args, **kwargs):
+        frames = list(frames)
+        copied_rows.append(sum(len(frame) for frame in frames))
+        return concat(frames, *args, **kwargs)
+
+    monkeypatch.setattr(pd, "concat", counting_concat)
+
+    result = loader.load_block_data(facade, "some_key", "a_random_name")
+
+    assert len(result) == report_steps * (ensemble_size + 2)
+    assert copied_rows == [len(result)]
@@ -31,6 +31,7 @@ def _set_multiindex(df):
     tuples = list(zip(*[df.columns.to_list(), df.columns.to_list()]))
     return pd.MultiIndex.from_tuples(tuples, names=["key_index", "data_index"])
 
+
 @pytest.mark.usefixtures("facade", "valid_dataframe", "measured_data_setup")
 @pytest.mark.parametrize("obs_type", [("GEN_OBS"), ("SUMMARY_OBS"), ("BLOCK_OBS")])
 def test_get_data(obs_type, monkeypatch, facade, valid_dataframe, measured_data_setup):
@@ -53,6 +54,34 @@ def test_get_data(obs_type, monkeypatch, facade, valid_dataframe, measured_data_
     assert md._data.equals(expected_result)
 
 
+@pytest.mark.usefixtures("facade")
+def test_get_data_multiple_keys(monkeypatch, facade):
+    facade.get_impl_type_name_for_obs_key.return_value = "GEN_OBS"
+    blocks = {
+        "key_a": pd.DataFrame(
+            data=[[1, 2], [0.1, 0.2], [1.1, 2.1], [1.2, 2.2]],
+            index=["OBS", "STD", 0, 1],
+        ),
+        "key_b": pd.DataFrame(
+            data=[[3], [0.3], [3.1], [3.2]], index=["OBS", "STD", 1, 2]
+        ),
+    }
+    mocked_loader = Mock(side_effect=lambda _, key, __: blocks[key].copy())
+    monkeypatch.setattr(loader, "data_loader_factory", Mock(return_value=mocked_loader))
+
+    md = MeasuredData(facade, ["key_a", "key_b"])
+
+    assert list(md.data.index) == ["OBS", "STD", 0, 1, 2]
+    assert list(md.data.columns) == [
+        ("key_a", 0, 0),
+        ("key_a", 1, 1),
+        ("key_b", 0, 0),
+    ]
+    assert pd.isnull(md.data.loc[2, ("key_a", 0, 0)])
+    assert pd.isnull(md.data.loc[0, ("key_b", 0, 0)])
+    assert md.data.loc[1].tolist() == [1.2, 2.2, 3.1]
+
+
 @pytest.mark.usefixtures("facade", "valid_dataframe", "measured_data_setup")
 @pytest.mark.parametrize(
     "invalid_input,expected_error",
@@ -282,3 +311,34 @@ def test_get_simulated_data(
 
     result = md.get_simulated_data()
     assert result.equals(pd.concat({"test_key": expected_result.astype(float)}, axis=1))
+
+
+@pytest.mark.usefixtures("facade", "measured_data_setup")
+def test_chained_filters(monkeypatch, facade, measured_data_setup):
+    input_dataframe = pd.DataFrame(
+        data=[
+            [1, 2, 3, 4],
+            [0.1, 0.2, 0.3, None],
+            [1.1, 1.6, 3.0, 4.0],
+            [1.0, 2.5, 3.0, 4.5],
+            [None, None, None, None],
+        ],
+        index=["OBS", "STD", 1, 2, 3],
+    )
+    measured_data_setup(input_dataframe, monkeypatch)
+    md = MeasuredData(facade, ["test_key"])
+    backing = md._values
+
+    md.remove_failed_realizations()
+    md.remove_inactive_observations()
+    md.filter_ensemble_std(0.0)
+    md.filter_ensemble_mean_obs(0.2)
+
+    expected_result = pd.DataFrame(
+        data=[[2.0], [0.2], [1.6], [2.5]], index=["OBS", "STD", 1, 2], columns=[1]
+    )
+    expected_result.columns = _set_multiindex(expected_result)
+    assert md.data.equals(pd.concat({"test_key": expected_result}, axis=1))
+    assert md.data is md.data
+    assert md._values is backing
+    assert not md.is_empty()
@@ -0,0 +1,75 @@
+import datetime
+import sys
+
+import numpy as np
+import pytest
+
+from ert_data.observation_index import ObservationIndex
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import Mock, MagicMock
+else:
+    from mock import Mock, MagicMock
+
+
+def _summary_node(value, std):
+    node = Mock()
+    node.getValue.return_value = value
+    node.getStandardDeviation.return_value = std
+    return node
+
+
+@pytest.fixture()
+def index_facade():
+    observations = MagicMock()
+    obs_vectors = {}
+    observations.__getitem__.side_effect = obs_vectors.__getitem__
+    observations.getObservationTime.side_effect = lambda step: Mock(
+        datetime=Mock(return_value=datetime.datetime(2010, 1, step))
+    )
+
+    facade = Mock()
+    facade.get_observations.return_value = observations
+    facade.obs_vectors = obs_vectors
+    return facade
+
+
+def test_summary_observations(index_facade):
+    nodes = {2: _summary_node(10.0, 1.0), 5: _summary_node(20.0, 2.0)}
+    obs_vector = Mock()
+    obs_vector.getStepList.return_value.asList.return_value = [2, 5]
+    obs_vector.getNode.side_effect = nodes.__getitem__
+    index_facade.obs_vectors["FOPR"] = obs_vector
+    index_facade.get_impl_type_name_for_obs_key.return_value = "SUMMARY_OBS"
+
+    entry = ObservationIndex(index_facade)["FOPR"]
+
+    assert entry.values.tolist() == [10.0, 20.0]
+    assert entry.stds.tolist() == [1.0, 2.0]
+    assert entry.key_indexes.tolist() == [
+        datetime.datetime(2010, 1, 2),
+        datetime.datetime(2010, 1, 5),
+    ]
+    index_facade.load_observation_data.assert_not_called()
+    index_facade.get_current_fs.assert_not_called()
+
+
+def test_entries_are_resolved_once(index_facade):
+    obs_vector = Mock()
+    obs_vector.getStepList.return_value.asList.return_value = [1]
+    obs_vector.getNode.return_value = _summary_node(1.0, 0.1)
+    index_facade.obs_vectors["FOPR"] = obs_vector
+    index_facade.get_impl_type_name_for_obs_key.return_value = "SUMMARY_OBS"
+    index = ObservationIndex(index_facade)
+
+    assert index["FOPR"] is index["FOPR"]
+    obs_vector.getNode.assert_called_once_with(1)
+
+
+@pytest.mark.parametrize("observation_type", ["GEN_OBS", "BLOCK_OBS", "BAD_TYPE"])
+def test_only_summary_observations_are_indexed(index_facade, observation_type):
+    index_facade.obs_vectors["OTHER"] = Mock()
+    index_facade.get_impl_type_name_for_obs_key.return_value = observation_type
+
+    with pytest.raises(TypeError):
+        ObservationIndex(index_facade)["OTHER"]
@@ -76,9 +76,9 @@ def get_files_excluded_from_black(root):
         "ert_gui/simulation/progress.py",
         "ert_gui/tools/export/export_tool.py",
         "ert_gui/simulation/simulation_panel.py",
-        "ert_gui/tools/export/export_model.py",
+        "ert_shared/export/export_model.py",
         "ert_gui/plottery/plots/ccsp.py",
-        "ert_gui/tools/export/export_keyword_model.py",
+        "ert_shared/export/export_keyword_model.py",
         "ert_gui/tools/help/help_tool.py",
         "ert_gui/tools/file/file_update_worker.py",
         "ert_gui/tools/file/file_dialog.py",
@@ -0,0 +1,162 @@
+import sys
+import threading
+import time
+import unittest
+
+from ert_shared.export.parallel_export import ParallelExport
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import MagicMock, patch
+else:
+    from mock import MagicMock, patch
+
+
+class ParallelExportTest(unittest.TestCase):
+    def test_realizations_are_exported_in_parallel(self):
+        barrier = threading.Barrier(4) if hasattr(threading, "Barrier") else None
+        threads = set()
+
+        def export_realization(iens):
+            threads.add(threading.current_thread().name)
+            if barrier is not None and iens < 4:
+                barrier.wait(5)
+            if iens == 5:
+                raise IOError("Disk full")
+            return iens != 7
+
+        export = ParallelExport(range(10), export_realization, workers=4)
+        self.assertEqual((0, 10), export.progress())
+        self.assertFalse(export.run())
+
+        if barrier is not None:
+            self.assertEqual(4, len(threads))
+        self.assertEqual((10, 10), export.progress())
+        self.assertEqual([0, 1, 2, 3, 4, 6, 8, 9], export.exported())
+        self.assertEqual({5: "Disk full"}, export.failed())
+
+    def test_cancel_skips_remaining_realizations(self):
+        started = threading.Event()
+        release = threading.Event()
+
+        def export_realization(iens):
+            started.set()
+            release.wait(5)
+            return True
+
+        export = ParallelExport(range(10), export_realization, workers=1)
+        export.start()
+        self.assertTrue(started.wait(5))
+        export.cancel()
+        release.set()
+
+        self.assertTrue(export.wait(5))
+        self.assertTrue(export.isCancelled())
+        self.assertEqual([0], export.exported())
+        self.assertEqual((1, 10), export.progress())
+
+
+class ExportModelTest(unittest.TestCase):
+    def test_gen_kw_export_uses_a_node_per_thread(self):
+        from ert_shared.export import export_model
+
+        with patch.object(export_model, "ERT"), patch.object(
+            export_model, "EnkfConfigNode", MagicMock
+        ), patch.object(export_model, "EnkfNode") as enkf_node, patch.object(
+            export_model, "ExportKeywordModel"
+        ), patch.object(
+            export_model, "GenKw"
+        ) as gen_kw:
+            enkf_node.return_value.tryLoad.side_effect = lambda fs, node_id: True
+            export = export_model.ExportModel().createGenKwExport(
+                "KW", "path", [True, False, True], "Parameter list", 0, "case", 2
+            )
+            self.assertTrue(export.run())
+
+        self.assertEqual([0, 2], export.exported())
+        self.assertLessEqual(enkf_node.call_count, 2)
+        exported = sorted(
+            call[0][0]
+            for call in gen_kw.createCReference.return_value.exportParameters.call_args_list
+        )
+        self.assertEqual(["path/KW_0.txt", "path/KW_2.txt"], exported)
+
+    def test_gen_data_loads_from_a_case_one_at_a_time(self):
+        from ert_shared.export import export_model
+
+        loading = []
+        overlapping = []
+
+        def try_load(fs, node_id):
+            loading.append(node_id)
+            overlapping.append(len(loading) > 1)
+            time.sleep(0.01)
+            loading.remove(node_id)
+            return True
+
+        with patch.object(export_model, "ERT"), patch.object(
+            export_model, "EnkfNode"
+        ) as enkf_node, patch.object(export_model, "ExportKeywordModel"):
+            enkf_node.return_value.tryLoad.side_effect = try_load
+            export = export_model.ExportModel().createGenDataExport(
+                "KW", "path", [True] * 8, None, 0, "case", 4
+            )
+            self.assertTrue(export.run())
+
+        self.assertEqual(list(range(8)), export.exported())
+        self.assertEqual([False] * 8, overlapping)
+
+    def test_fields_are_loaded_one_at_a_time_and_written_in_parallel(self):
+        from ert_shared.export import export_model
+
+        loading = []
+        overlapping = []
+        barrier = threading.Barrier(2) if hasattr(threading, "Barrier") else None
+
+        def try_load(fs, node_id):
+            loading.append(node_id)
+            overlapping.append(len(loading) > 1)
+            time.sleep(0.01)
+            loading.remove(node_id)
+            return True
+
+        def write(filename, file_type=None, arg=None):
+            if barrier is not None:
+                barrier.wait(5)
+
+        iactive = MagicMock()
+        iactive.createActiveList.return_value = [0, 1]
+        with patch.object(export_model, "ERT") as ert, patch.object(
+            export_model, "EnkfNode"
+        ) as enkf_node, patch.object(export_model, "ExportKeywordModel"):
+            config_node = ert.ert.ensembleConfig.return_value.__getitem__.return_value
+            config_node.getInitFile.return_value = None
+            enkf_node.return_value.tryLoad.side_effect = try_load
+            enkf_node.return_value.export.side_effect = write
+            export = export_model.ExportModel().createFieldExport(
+                "PORO",
+                "path",
+                iactive,
+                export_model.EnkfFieldFileFormatEnum.ECL_GRDECL_FILE,
+                0,
+                "case",
+                2,
+            )
+            self.assertTrue(export.run())
+
+        self.assertEqual([0, 1], export.exported())
+        self.assertEqual([False] * 2, overlapping)
+        self.assertEqual(
+            ["path/PORO_0.grdecl", "path/PORO_1.grdecl"],
+            sorted(call[0][0] for call in enkf_node.return_value.export.call_args_list),
+        )
+
+    def test_case_locks_belong_to_the_model(self):
+        from ert_shared.export import export_model
+
+        with patch.object(export_model, "ExportKeywordModel"):
+            model = export_model.ExportModel()
+            other_model = export_model.ExportModel()
+
+        self.assertIs(model._caseLock("case"), model._caseLock("case"))
+        self.assertIsNot(model._caseLock("case"), model._caseLock("other"))
+        self.assertIsNot(model._caseLock("case"), other_model._caseLock("case"))
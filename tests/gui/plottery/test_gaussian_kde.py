@@ -0,0 +1,70 @@
+import numpy
+import pandas as pd
+from mock import MagicMock
+from scipy.stats import gaussian_kde
+
+from ert_gui.plottery.plots.gaussian_kde import (
+    KDECache,
+    _plotGaussianKDE,
+    binnedGaussianKDE,
+    scottBandwidth,
+)
+
+
+def test_scott_bandwidth_matches_scipy():
+    values = numpy.random.RandomState(42).normal(size=500)
+
+    scipy_kde = gaussian_kde(values)
+    expected = numpy.sqrt(scipy_kde.covariance[0, 0])
+
+    assert numpy.isclose(scottBandwidth(values), expected)
+
+
+def test_binned_kde_matches_scipy():
+    values = numpy.random.RandomState(42).lognormal(size=2000)
+    bandwidth = scottBandwidth(values)
+
+    grid, density = binnedGaussianKDE(values, bandwidth)
+    expected = gaussian_kde(values).evaluate(grid)
+
+    assert len(grid) == len(density)
+    assert numpy.isclose(grid[0], values.min() - 0.5 * numpy.ptp(values))
+    assert numpy.isclose(grid[-1], values.max() + 0.5 * numpy.ptp(values))
+    assert numpy.max(numpy.abs(density - expected)) < 1e-2 * numpy.max(expected)
+    assert numpy.isclose(numpy.trapz(density, grid), 1.0, atol=1e-2)
+
+
+def test_kde_is_cached_per_case_key_and_bandwidth():
+    data = pd.Series(numpy.random.RandomState(1).normal(size=100))
+    axes = MagicMock()
+    axes.plot.return_value = []
+    cache = KDECache()
+
+    _plotGaussianKDE(axes, MagicMock(), data, "default", "KEY", cache)
+    assert len(cache) == 1
+    first_x, first_y = axes.plot.call_args[0]
+
+    _plotGaussianKDE(axes, MagicMock(), data, "default", "KEY", cache)
+    assert len(cache) == 1
+    second_x, second_y = axes.plot.call_args[0]
+    assert second_x is first_x
+    assert second_y is first_y
+
+    _plotGaussianKDE(axes, MagicMock(), data, "other", "KEY", cache)
+    assert len(cache) == 2
+
+    _plotGaussianKDE(axes, MagicMock(), data * 2, "default", "KEY", cache)
+    assert len(cache) == 3
+
+
+def test_kde_cache_evicts_least_recently_used():
+    cache = KDECache(max_size=2)
+    cache["a"] = 1
+    cache["b"] = 2
+    assert cache.get("a") == 1
+
+    cache["c"] = 3
+    assert len(cache) == 2
+    assert cache.get("b") is None
+    assert cache.get("a") == 1
+    assert cache.get("c") == 3
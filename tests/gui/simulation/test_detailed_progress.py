@@ -0,0 +1,57 @@
+from ert_gui.simulation.detailed_progress import DetailedProgress
+
+STATE_COLORS = {"Running": (0, 0, 255), "Success": (0, 255, 0)}
+
+
+class Job(object):
+    def __init__(self, status):
+        self.status = status
+
+
+def _pixel(widget, x, y):
+    return widget._foreground_image.pixelColor(x, y).getRgb()
+
+
+def test_update_only_redraws_changed_realizations(qtbot):
+    widget = DetailedProgress(STATE_COLORS, None)
+    qtbot.addWidget(widget)
+    widget.resize(400, 400)
+
+    widget.set_progress({iens: ([Job("Running")] * 4, None) for iens in range(100)}, 0)
+    image = widget._foreground_image
+    assert (widget.grid_width, widget.grid_height) == (10, 10)
+    assert _pixel(widget, 2, 0) == (0, 0, 255, 255)
+
+    widget.set_progress({1: ([Job("Success")], None)}, 0)
+
+    assert widget._foreground_image is image
+    assert _pixel(widget, 2, 0) == (0, 255, 0, 255)
+    assert _pixel(widget, 3, 0) == (0, 0, 0, 0)
+    assert _pixel(widget, 0, 0) == (0, 0, 255, 255)
+
+
+def test_layout_change_renders_new_image(qtbot):
+    widget = DetailedProgress(STATE_COLORS, None)
+    qtbot.addWidget(widget)
+    widget.resize(400, 400)
+
+    widget.set_progress({0: ([Job("Running")], None)}, 0)
+    image = widget._foreground_image
+    widget.set_progress({99: ([Job("Running")], None)}, 0)
+
+    assert widget._foreground_image is not image
+    assert widget.grid_width * widget.grid_height >= 100
+
+
+def test_progress_without_room_is_drawn_once_there_is(qtbot):
+    widget = DetailedProgress(STATE_COLORS, None)
+    qtbot.addWidget(widget)
+    widget.resize(0, 400)
+
+    widget.set_progress({0: ([Job("Running")], None)}, 0)
+    widget.set_progress({0: ([Job("Success")], None)}, 0)
+    assert widget._foreground_image is None
+
+    widget.resize(400, 400)
+    widget.set_progress({1: ([Job("Running")], None)}, 0)
+    assert _pixel(widget, 0, 0) == (0, 255, 0, 255)
@@ -3,6 +3,7 @@ import os
 import pytest
 
 import ert_gui
+import ert_shared.export
 from ert_gui.tools import HelpCenter
 
 from distutils.version import StrictVersion
@@ -78,7 +79,7 @@ def patch_enkf_main(monkeypatch, tmpdir):
         Mock(return_value=[]),
     )
     monkeypatch.setattr(
-        ert_gui.tools.export.export_keyword_model.ExportKeywordModel,
+        ert_shared.export.ExportKeywordModel,
         "hasKeywords",
         Mock(return_value=False),
     )
@@ -0,0 +1,174 @@
+import os
+import shutil
+import tempfile
+
+import numpy
+import pytest
+from qtpy.QtCore import QAbstractListModel, QModelIndex, QObject, Qt, Signal
+
+from ert_gui.tools.file import FileModel, FileUpdateWorker, FileView
+
+
+@pytest.fixture
+def log_file():
+    tmp_dir = tempfile.mkdtemp()
+    yield os.path.join(tmp_dir, "job.stdout")
+    shutil.rmtree(tmp_dir)
+
+
+def _append(file_name, model, data):
+    with open(file_name, "ab") as f:
+        f.write(data)
+    size = os.path.getsize(file_name)
+    with open(file_name, "rb") as f:
+        content = f.read()
+    start = model._size
+    line_ends = numpy.array(
+        [i for i in range(start, size) if content[i : i + 1] == b"\n"],
+        dtype=numpy.int64,
+    )
+    model.append_lines(line_ends, size)
+
+
+def _rows(model):
+    return [model.data(model.index(row, 0)) for row in range(model.rowCount())]
+
+
+def test_rows_are_read_from_the_mapped_file(log_file):
+    model = FileModel(log_file)
+    inserted = []
+    model.rowsInserted.connect(
+        lambda parent, first, last: inserted.append((first, last))
+    )
+
+    _append(log_file, model, b"first\r\nsecond\n")
+    assert _rows(model) == ["first", "second"]
+
+    _append(log_file, model, b"thi")
+    assert _rows(model) == ["first", "second", "thi"]
+
+    _append(log_file, model, b"rd\nfourth\n")
+    assert _rows(model) == ["first", "second", "third", "fourth"]
+    assert inserted == [(0, 1), (2, 2), (3, 3)]
+
+    assert model.max_line_length() == 6
+    assert model.row_offset(2) == 14
+    assert model.row_at(15) == 2
+    assert model.row_at(23) == 3
+    model.close()
+
+
+def test_view_only_paints_visible_rows(qtbot, log_file):
+    model = FileModel(log_file)
+    view = FileView()
+    qtbot.addWidget(view)
+    view.setModel(model)
+    view.resize(400, 200)
+
+    requested = []
+    data = model.data
+    model.data = lambda index, *args: requested.append(index.row()) or data(index)
+
+    _append(log_file, model, b"".join(b"line %d\n" % i for i in range(100000)))
+    view.enable_follow_mode(True)
+    view.grab()
+
+    assert requested
+    assert max(requested) == 99999
+    assert len(set(requested)) < 1000
+    model.close()
+
+
+class _LargeModel(QAbstractListModel):
+    """A model of more rows than fit in the pixels of a scroll bar"""
+
+    def __init__(self, rows):
+        super(_LargeModel, self).__init__()
+        self._rows = 0
+        self.beginInsertRows(QModelIndex(), 0, rows - 1)
+        self._rows = rows
+        self.endInsertRows()
+
+    def rowCount(self, parent=QModelIndex()):
+        return self._rows
+
+    def data(self, index, role=Qt.DisplayRole):
+        if role == Qt.DisplayRole:
+            return "line {}".format(index.row())
+
+    def max_line_length(self):
+        return 20
+
+
+def test_view_scrolls_through_more_pixels_than_fit_in_a_scroll_bar(qtbot):
+    rows = 2**30
+    view = FileView()
+    qtbot.addWidget(view)
+    view.resize(400, 200)
+    model = _LargeModel(0)
+    view.setModel(model)
+    model.beginInsertRows(QModelIndex(), 0, rows - 1)
+    model._rows = rows
+    model.endInsertRows()
+
+    scroll_bar = view.verticalScrollBar()
+    assert scroll_bar.maximum() == FileView.MAX_SCROLL_RANGE
+    assert scroll_bar.value() == scroll_bar.maximum()
+    assert view.first_visible_row() > rows - 50
+
+    view.scroll_to_row(rows // 2)
+    assert abs(view.first_visible_row() - rows // 2) <= 1
+    assert abs(scroll_bar.value() - scroll_bar.maximum() // 2) < 1000
+
+    scroll_bar.setValue(0)
+    assert view.first_visible_row() == 0
+    view.grab()
+
+
+def test_find_wraps_around(log_file):
+    with open(log_file, "wb") as f:
+        f.write(b"ERROR at start\n" + b"x" * 100 + b"\nlast ERROR\n")
+
+    with open(log_file, "rb") as f:
+        worker = FileUpdateWorker(f)
+        worker.READ_BUFFER_SIZE = 16
+        worker._size = os.path.getsize(log_file)
+        found = []
+        worker.found.connect(found.append)
+
+        worker.find(b"ERROR", 1)
+        worker.find(b"ERROR", 123)
+        worker.find(b"WARNING", 0)
+
+    assert found == [121, 0, -1]
+
+
+class _Requester(QObject):
+    find_requested = Signal(object, object)
+
+
+def test_offsets_above_2gib_pass_through_signals(qtbot, log_file):
+    match_offset = 2**31 + 8
+    with open(log_file, "wb") as f:
+        f.seek(match_offset)
+        f.write(b"match\n")  # The file is sparse up to the match
+    size = match_offset + 6
+
+    model = FileModel(log_file)
+    requester = _Requester()
+    with open(log_file, "rb") as f:
+        worker = FileUpdateWorker(f)
+        worker.read.connect(model.append_lines)
+        requester.find_requested.connect(worker.find)
+        found = []
+        worker.found.connect(found.append)
+
+        worker.read.emit(numpy.array([size - 1], dtype=numpy.int64), size)
+        worker._size = size
+        requester.find_requested.emit(b"match", 2**31)
+
+    assert found == [match_offset]
+    assert model.rowCount() == 1
+    assert model.row_at(match_offset) == 0
+    assert model.max_line_length() == size - 1
+    model.close()
@@ -0,0 +1,93 @@
+import os
+import shutil
+import sys
+import tempfile
+
+import pytest
+
+from ert_gui.tools.file.file_update_worker import FileUpdateWorker, file_system_type
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import patch
+else:
+    from mock import patch
+
+
+@pytest.fixture
+def tmp_dir():
+    tmp_dir = tempfile.mkdtemp()
+    yield tmp_dir
+    shutil.rmtree(tmp_dir)
+
+
+def _worker(file_name):
+    worker = FileUpdateWorker(open(file_name, "rb"))
+    sizes = []
+    worker.read.connect(lambda line_ends, size: sizes.append(size))
+    return worker, sizes
+
+
+def test_file_system_type(tmp_dir):
+    mounts = os.path.join(tmp_dir, "mounts")
+    with open(mounts, "w") as f:
+        f.write("/dev/sda1 / ext4 rw 0 0\n")
+        f.write("server:/export /scratch nfs4 rw 0 0\n")
+        f.write("server:/export /scratch\\040data nfs rw 0 0\n")
+
+    assert file_system_type("/scratch/run/job.stdout", mounts) == "nfs4"
+    assert file_system_type("/scratch data/job.stdout", mounts) == "nfs"
+    assert file_system_type("/scratchy/job.stdout", mounts) == "ext4"
+    assert file_system_type("/tmp", os.path.join(tmp_dir, "missing")) is None
+
+
+def test_appended_data_is_read_when_file_changes(qtbot, tmp_dir):
+    file_name = os.path.join(tmp_dir, "job.stdout")
+    with open(file_name, "wb") as f:
+        f.write(b"first\n")
+
+    worker, sizes = _worker(file_name)
+    with patch(
+        "ert_gui.tools.file.file_update_worker.file_system_type", return_value="ext4"
+    ):
+        worker.setup()
+    assert worker.is_watching()
+
+    qtbot.waitUntil(lambda: sizes == [6])
+    assert not worker._timer.isActive()
+
+    with open(file_name, "ab") as f:
+        f.write(b"second\n" * 1000)
+    qtbot.waitUntil(lambda: sizes == [6, 7006])
+    worker.stop()
+
+
+def test_network_file_systems_are_polled(qtbot, tmp_dir):
+    file_name = os.path.join(tmp_dir, "job.stdout")
+    with open(file_name, "wb") as f:
+        f.write(b"first\n")
+
+    worker, sizes = _worker(file_name)
+    with patch(
+        "ert_gui.tools.file.file_update_worker.file_system_type", return_value="nfs"
+    ):
+        worker.setup()
+    assert not worker.is_watching()
+
+    worker._read_file()
+    assert sizes == [6]
+    assert worker._timer.interval() == FileUpdateWorker.MIN_POLL_TIMER_MS
+
+    worker._read_file()
+    worker._read_file()
+    assert worker._timer.interval() == 4 * FileUpdateWorker.MIN_POLL_TIMER_MS
+
+    for _ in range(10):
+        worker._read_file()
+    assert worker._timer.interval() == FileUpdateWorker.MAX_POLL_TIMER_MS
+
+    with open(file_name, "ab") as f:
+        f.write(b"second\n")
+    worker._read_file()
+    assert sizes == [6, 13]
+    assert worker._timer.interval() == FileUpdateWorker.MIN_POLL_TIMER_MS
+    worker.stop()
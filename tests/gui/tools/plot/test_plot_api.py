@@ -9,6 +9,7 @@ from res.enkf import EnKFMain, ResConfig
 from ert_shared.libres_facade import LibresFacade
 from tests.utils import SOURCE_DIR, tmpdir
 from unittest import TestCase
+from mock import Mock
 
 
 class PlotApiTest(TestCase):
@@ -124,3 +125,22 @@ class PlotApiTest(TestCase):
         }
 
         self.assertEqual(expected, case)
+
+
+def test_gen_kw_data_cache_is_bounded_and_cleared():
+    facade = Mock()
+    facade.gather_all_gen_kw_data.side_effect = lambda case: DataFrame({"KEY": [1.0, 2.0]})
+    api = PlotApi(facade)
+
+    for case in range(PlotApi.GEN_KW_CACHE_SIZE + 1):
+        api._gen_kw_data_for_key(case, "KEY")
+    assert facade.gather_all_gen_kw_data.call_count == PlotApi.GEN_KW_CACHE_SIZE + 1
+
+    api._gen_kw_data_for_key(PlotApi.GEN_KW_CACHE_SIZE, "KEY")
+    assert facade.gather_all_gen_kw_data.call_count == PlotApi.GEN_KW_CACHE_SIZE + 1
+    api._gen_kw_data_for_key(0, "KEY")
+    assert facade.gather_all_gen_kw_data.call_count == PlotApi.GEN_KW_CACHE_SIZE + 2
+
+    api.clear_cache()
+    api._gen_kw_data_for_key(0, "KEY")
+    assert facade.gather_all_gen_kw_data.call_count == PlotApi.GEN_KW_CACHE_SIZE + 3
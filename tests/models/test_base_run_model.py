@@ -1,4 +1,7 @@
+import os
+import shutil
 import sys
+import tempfile
 import unittest
 
 from ert_gui.ertnotifier import configureErtNotifier
@@ -35,6 +38,7 @@ class InMemoryBaseRunModelTest(unittest.TestCase):
         run_arg2 = Mock()
         run_arg2.getQueueIndex.return_value = 1
         run_arg2.iens = 0
+        run_arg2.runpath = "/non/existing/runpath"
         brm._run_context.__iter__ = Mock()
         brm._run_context.__iter__.return_value = iter([run_arg1, run_arg2])
 
@@ -46,6 +50,7 @@ class InMemoryBaseRunModelTest(unittest.TestCase):
 
         brm._job_queue = Mock()
         brm._job_queue.getJobStatus.side_effect = job_status
+        brm._job_telemetry = Mock()
 
         with patch("ert_shared.models.base_run_model.ForwardModelStatus") as f:
             f.load.return_value = Mock()
@@ -55,3 +60,150 @@ class InMemoryBaseRunModelTest(unittest.TestCase):
         jobs, status = brm.realization_progress[0][0]
         self.assertEqual(len(jobs), 1)
         self.assertIn("name", jobs[0])
+
+    def test_phase_changes_are_published(self):
+        brm = BaseRunModel(None, phase_count=2)
+        state_changes = brm.subscribe()
+
+        brm.setPhase(1, "Running simulations...")
+        brm.setPhaseName("Post processing...")
+        brm.unsubscribe(state_changes)
+        brm.setPhase(2, "Simulations completed.")
+
+        first = state_changes.get_nowait()
+        self.assertEqual(
+            (1, "Running simulations...", False),
+            (first.phase, first.phase_name, first.finished),
+        )
+        second = state_changes.get_nowait()
+        self.assertEqual("Post processing...", second.phase_name)
+        self.assertTrue(state_changes.empty())
+
+    def test_queue_status(self):
+        brm = BaseRunModel(None)
+        self.assertEqual({}, brm.getQueueStatus())
+
+        statuses = [
+            JobStatusType.JOB_QUEUE_RUNNING,
+            JobStatusType.JOB_QUEUE_DONE,
+            JobStatusType.JOB_QUEUE_RUNNING,
+        ]
+        brm._job_queue = Mock()
+        brm._job_queue.__len__ = Mock(return_value=len(statuses))
+        brm._job_queue.getJobStatus.side_effect = lambda idx: statuses[idx]
+        self.assertEqual({}, brm.getQueueStatus())
+
+        brm._job_queue_watcher.poll()
+        self.assertEqual(
+            {JobStatusType.JOB_QUEUE_RUNNING: 2, JobStatusType.JOB_QUEUE_DONE: 1},
+            brm.getQueueStatus(),
+        )
+
+    def test_unchanged_status_file_is_not_reloaded(self):
+        tmp_dir = tempfile.mkdtemp()
+        try:
+            brm = BaseRunModel(None)
+            brm._run_context = Mock()
+            brm._run_context.get_iter.return_value = 0
+
+            run_arg = Mock()
+            run_arg.getQueueIndex.return_value = 0
+            run_arg.iens = 0
+            run_arg.runpath = tmp_dir
+            brm._run_context.__iter__ = Mock(side_effect=lambda: iter([run_arg]))
+
+            brm._job_queue = Mock()
+            brm._job_queue.getJobStatus.return_value = JobStatusType.JOB_QUEUE_RUNNING
+
+            with open(os.path.join(tmp_dir, "status.json"), "w") as status_file:
+                status_file.write("{}")
+
+            with patch("ert_shared.models.base_run_model.ForwardModelStatus") as f:
+                job = Mock()
+                job.status = "Running"
+                f.load.return_value.jobs = [job]
+
+                brm.updateDetailedProgress()
+                brm.updateDetailedProgress()
+                self.assertEqual(1, f.load.call_count)
+
+                with open(os.path.join(tmp_dir, "status.json"), "w") as status_file:
+                    status_file.write('{"jobs": []}')
+                brm.updateDetailedProgress()
+                self.assertEqual(2, f.load.call_count)
+
+            progress, iteration = brm.getDetailedProgress()
+            self.assertEqual(0, iteration)
+            self.assertEqual(([job], JobStatusType.JOB_QUEUE_RUNNING), progress[0][0])
+        finally:
+            shutil.rmtree(tmp_dir)
+
+    def test_detailed_progress_changes(self):
+        brm = BaseRunModel(None)
+        brm._run_context = Mock()
+        brm._run_context.get_iter.return_value = 0
+
+        run_args = []
+        for iens in range(3):
+            run_arg = Mock()
+            run_arg.getQueueIndex.return_value = iens
+            run_arg.iens = iens
+            run_arg.runpath = "/non/existing/runpath"
+            run_args.append(run_arg)
+        brm._run_context.__iter__ = Mock(side_effect=lambda: iter(run_args))
+
+        statuses = [JobStatusType.JOB_QUEUE_RUNNING] * 3
+        brm._job_queue = Mock()
+        brm._job_queue.getJobStatus.side_effect = lambda idx: statuses[idx]
+
+        with patch("ert_shared.models.base_run_model.ForwardModelStatus") as f:
+            job = Mock(start_time=None, end_time=None, max_memory_usage=None)
+            job.status = "Success"
+            f.load.return_value.jobs = [job]
+
+            changes, iteration, sequence = brm.getDetailedProgressChanges()
+            self.assertEqual([0, 1, 2], sorted(changes[0]))
+            self.assertEqual(0, iteration)
+
+            changes, _, sequence = brm.getDetailedProgressChanges(sequence)
+            self.assertEqual({}, changes)
+
+            statuses[1] = JobStatusType.JOB_QUEUE_SUCCESS
+            changes, _, next_sequence = brm.getDetailedProgressChanges(sequence)
+            self.assertEqual(
+                {0: {1: ([job], JobStatusType.JOB_QUEUE_SUCCESS)}}, changes
+            )
+
+            statuses[1] = JobStatusType.JOB_QUEUE_RUNNING
+            statuses[2] = JobStatusType.JOB_QUEUE_SUCCESS
+            changes, _, _ = brm.getDetailedProgressChanges(next_sequence)
+            self.assertEqual([1, 2], sorted(changes[0]))
+
+            # Only the latest change of each realization is kept
+            changes, _, _ = brm.getDetailedProgressChanges(sequence)
+            self.assertEqual([1, 2], sorted(changes[0]))
+            self.assertEqual(3, len(brm._progress_changes))
+
+    def test_status_files_are_watched_only_for_detailed_progress_consumers(self):
+        brm = BaseRunModel(None)
+        brm._status_file_watcher = Mock()
+        brm._status_file_watcher.isRunning.return_value = False
+        started = []
+
+        def run_simulations(arguments):
+            started.append(brm._status_file_watcher.start.call_count)
+            brm.watchDetailedProgress()
+            started.append(brm._status_file_watcher.start.call_count)
+            brm.unwatchDetailedProgress()
+            brm._status_file_watcher.stop.assert_called_once()
+            return Mock()
+
+        brm._startSimulations({"active_realizations": Mock()}, run_simulations)
+        self.assertEqual([0, 1], started)
+
+        brm._status_file_watcher.reset_mock()
+        brm.watchDetailedProgress()
+        brm._status_file_watcher.start.assert_not_called()
+        brm._startSimulations({"active_realizations": Mock()}, lambda _: Mock())
+        brm._status_file_watcher.start.assert_called_once()
+        brm.unwatchDetailedProgress()
@@ -0,0 +1,91 @@
+import os
+import shutil
+import sys
+import tempfile
+import unittest
+
+from ert_shared.models.ensemble_experiment import EnsembleExperiment
+from ert_shared.models.runpath_creation import RunpathCreation
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import MagicMock, Mock, patch
+else:
+    from mock import MagicMock, Mock, patch
+
+
+class EnsembleExperimentRestartTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp_dir = tempfile.mkdtemp()
+        self.runpaths = [
+            os.path.join(self.tmp_dir, "realization-{}".format(iens))
+            for iens in range(3)
+        ]
+        for runpath in self.runpaths:
+            os.makedirs(runpath)
+            with open(os.path.join(runpath, RunpathCreation.JOBS_FILE), "w") as f:
+                f.write("{}")
+
+    def tearDown(self):
+        shutil.rmtree(self.tmp_dir)
+
+    def _rerun(self, failed, job_queue=None):
+        module = "ert_shared.models.ensemble_experiment"
+        run_context = MagicMock()
+        run_context.__len__.return_value = len(self.runpaths)
+        run_context.is_active.side_effect = lambda iens: iens in failed
+        run_args = [Mock(runpath=runpath) for runpath in self.runpaths]
+        run_context.__getitem__.side_effect = lambda iens: run_args[iens]
+        run_context.get_iter.return_value = 0
+
+        with patch(module + ".ERT") as ert, patch(
+            "ert_shared.models.base_run_model.ERT", ert
+        ), patch(
+            "ert_shared.models.base_run_model.EnkfSimulationRunner"
+        ) as simulation_runner, patch(
+            module + ".ErtRunContext.ensemble_experiment", return_value=run_context
+        ), patch(
+            module + ".dump_to_new_storage"
+        ), patch(
+            "ert_shared.models.base_run_model.JobQueueRunner"
+        ) as job_queue_runner:
+            ert.ert.analysisConfig.return_value.get_stop_long_running.return_value = (
+                False
+            )
+            runner = ert.ert.getEnkfSimulationRunner.return_value
+            job_queue_runner.return_value.run.return_value = len(failed)
+
+            model = EnsembleExperiment()
+            model._job_queue = job_queue
+            self.assertTrue(model.support_fast_restart)
+            model.restartFailedRealizations(
+                {"active_realizations": [iens in failed for iens in range(3)]}
+            )
+
+            simulation_runner.runWorkflows.assert_not_called()
+            job_queue_runner.return_value.run.assert_called_once_with(run_context, None)
+        return model, runner
+
+    def test_rerun_reuses_runpaths(self):
+        model, runner = self._rerun(failed=[1])
+
+        runner.createRunPath.assert_not_called()
+        self.assertTrue(model.isFinished())
+        self.assertFalse(model.hasRunFailed())
+
+    def test_rerun_creates_missing_runpaths(self):
+        shutil.rmtree(self.runpaths[2])
+        _, runner = self._rerun(failed=[1, 2])
+
+        self.assertEqual(1, runner.createRunPath.call_count)
+
+    def test_rerun_clears_stale_status_and_uses_a_fresh_queue(self):
+        for runpath in self.runpaths[:2]:
+            for status_file in ("STATUS", "status.json", "ERROR"):
+                open(os.path.join(runpath, status_file), "w").close()
+        job_queue = MagicMock()
+
+        model, _ = self._rerun(failed=[1], job_queue=job_queue)
+
+        self.assertIsNot(job_queue, model._job_queue)
+        self.assertEqual([RunpathCreation.JOBS_FILE], os.listdir(self.runpaths[1]))
+        self.assertEqual(4, len(os.listdir(self.runpaths[0])))
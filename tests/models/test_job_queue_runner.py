@@ -0,0 +1,209 @@
+import sys
+import threading
+import unittest
+
+from ert_shared.models.job_queue_runner import JobQueueRunner
+from ert_shared.models.phase_profiler import PhaseProfiler
+from res.enkf.enums import RunStatusType
+from res.job_queue import JobStatusType
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import MagicMock, Mock, patch
+else:
+    from mock import MagicMock, Mock, patch
+
+
+class _JobQueue(object):
+    """Runs every job to the end as soon as it is launched"""
+
+    def __init__(self, failing=(), exit_after=None):
+        self.run_args = []
+        self.realizations = []
+        self.statuses = []
+        self.launched = []
+        self.launched_before_submit_complete = []
+        self.submitted_all = False
+        self.failing = failing
+        self.exit_after = exit_after
+        self.ok_callbacks = []
+        self.killed = False
+        self.completed = False
+
+    def add_job_from_run_arg(self, run_arg, res_config, max_runtime, ok, exit):
+        self.run_args.append(run_arg)
+        self.ok_callbacks.append(ok)
+        self.realizations.append(run_arg.iens)
+        self.statuses.append(JobStatusType.JOB_QUEUE_WAITING)
+
+    def submit_complete(self):
+        self.submitted_all = True
+
+    def getUserExit(self):
+        return self.exit_after is not None and len(self.launched) >= self.exit_after
+
+    def launch_jobs(self, pool_sema):
+        for index, iens in enumerate(self.realizations):
+            if self.statuses[index] == JobStatusType.JOB_QUEUE_WAITING:
+                self.launched.append(iens)
+                if not self.submitted_all:
+                    self.launched_before_submit_complete.append(iens)
+                failed = iens in self.failing
+                self.statuses[index] = (
+                    JobStatusType.JOB_QUEUE_FAILED
+                    if failed
+                    else JobStatusType.JOB_QUEUE_SUCCESS
+                )
+                self.run_args[index].run_status = (
+                    RunStatusType.JOB_RUN_FAILURE
+                    if failed
+                    else RunStatusType.JOB_LOAD_SUCCESSFUL
+                )
+
+    @property
+    def num_running(self):
+        return 0
+
+    @property
+    def num_complete(self):
+        return sum(
+            status in (JobStatusType.JOB_QUEUE_SUCCESS, JobStatusType.JOB_QUEUE_FAILED)
+            for status in self.statuses
+        )
+
+    def is_active(self):
+        return JobStatusType.JOB_QUEUE_WAITING in self.statuses
+
+    def kill_all_jobs(self):
+        self.killed = True
+        for index, status in enumerate(self.statuses):
+            if status == JobStatusType.JOB_QUEUE_WAITING:
+                self.statuses[index] = JobStatusType.JOB_QUEUE_IS_KILLED
+                self.run_args[index].run_status = RunStatusType.JOB_RUN_FAILURE
+
+    def assert_complete(self):
+        self.completed = True
+
+
+class _RunpathCreation(object):
+    """Makes more runpaths ready every time it is polled"""
+
+    def __init__(self, steps, error=None):
+        self._steps = steps
+        self._poll = 0
+        self._error = error
+
+    def isDone(self):
+        return self._poll >= len(self._steps) - 1
+
+    def wait(self, timeout=None):
+        if self._error is not None:
+            raise self._error
+
+    def readyRealizations(self):
+        ready = self._steps[min(self._poll, len(self._steps) - 1)]
+        self._poll += 1
+        return list(ready)
+
+
+def _run_context(active):
+    run_context = MagicMock()
+    run_context.__len__.return_value = len(active)
+    run_context.is_active.side_effect = lambda iens: active[iens]
+    run_context.get_step.return_value = 0
+    run_args = [Mock(iens=iens) for iens in range(len(active))]
+    run_context.__getitem__.side_effect = lambda iens: run_args[iens]
+    return run_context
+
+
+def _runner(job_queue, profiler=None):
+    ert = Mock()
+    ert.analysisConfig.return_value.get_max_runtime.return_value = 0
+    ert.eclConfig.return_value = Mock(spec=["assert_restart"])
+    return JobQueueRunner(
+        ert,
+        job_queue,
+        threading.RLock(),
+        threading.RLock(),
+        poll_interval=0,
+        profiler=profiler,
+    )
+
+
+class JobQueueRunnerTest(unittest.TestCase):
+    def test_realizations_are_launched_as_their_runpaths_are_ready(self):
+        job_queue = _JobQueue()
+        run_context = _run_context([True, True, True, False])
+        creation = _RunpathCreation([[0], [0, 1], [0, 1, 2]])
+
+        self.assertEqual(3, _runner(job_queue).run(run_context, creation))
+
+        self.assertEqual([0, 1, 2], job_queue.launched)
+        self.assertEqual([0, 1], job_queue.launched_before_submit_complete)
+        self.assertTrue(job_queue.completed)
+        self.assertFalse(job_queue.killed)
+        run_context.deactivate_realization.assert_not_called()
+
+    def test_failed_realizations_are_deactivated(self):
+        job_queue = _JobQueue(failing=[1])
+        run_context = _run_context([True, True, True])
+        runner = _runner(job_queue)
+
+        self.assertEqual(2, runner.run(run_context))
+
+        runner._ert.initRun.assert_called_once_with(run_context)
+        runner._ert.eclConfig.return_value.assert_restart.assert_not_called()
+        run_context.deactivate_realization.assert_called_once_with(1)
+
+    def test_restarts_are_checked(self):
+        run_context = _run_context([True])
+        run_context.get_step.return_value = 10
+        runner = _runner(_JobQueue())
+
+        runner.run(run_context)
+
+        runner._ert.eclConfig.return_value.assert_restart.assert_called_once_with()
+
+    def test_user_exit_kills_the_jobs_and_fails_the_rest(self):
+        job_queue = _JobQueue(exit_after=1)
+        run_context = _run_context([True, True, True])
+        creation = _RunpathCreation([[0], [0, 1], [0, 1, 2]])
+
+        self.assertEqual(1, _runner(job_queue).run(run_context, creation))
+
+        self.assertEqual([0], job_queue.launched)
+        self.assertTrue(job_queue.killed)
+        self.assertTrue(job_queue.completed)
+        self.assertEqual(
+            [1, 2],
+            [c[0][0] for c in run_context.deactivate_realization.call_args_list],
+        )
+
+    def test_runpath_creation_errors_kill_the_jobs(self):
+        job_queue = _JobQueue()
+        run_context = _run_context([True, True])
+        creation = _RunpathCreation([[0], [0, 1]], error=IOError("Disk full"))
+
+        with self.assertRaises(IOError):
+            _runner(job_queue).run(run_context, creation)
+        self.assertTrue(job_queue.killed)
+
+    def test_queue_wait_and_result_loading_are_profiled(self):
+        now = [100.0]
+        profiler = PhaseProfiler(clock=lambda: now[0])
+        job_queue = _JobQueue()
+
+        _runner(job_queue, profiler).run(_run_context([True, True]))
+
+        self.assertEqual(
+            [("Queue wait", "queue")],
+            [(span.name, span.category) for span in profiler.spans()],
+        )
+
+        with patch("ert_shared.models.job_queue_runner.EnKFState") as state:
+            state.forward_model_ok_callback.return_value = (0, "")
+            self.assertEqual((0, ""), job_queue.ok_callbacks[0]("callback_args"))
+        state.forward_model_ok_callback.assert_called_once_with("callback_args")
+        self.assertEqual(
+            [("Queue wait", "queue"), ("Load results", "load")],
+            [(span.name, span.category) for span in profiler.spans()],
+        )
@@ -0,0 +1,155 @@
+import sys
+import unittest
+
+from ert_shared.models.job_queue_watcher import JobQueueWatcher
+from res.job_queue import JobStatusType
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import MagicMock, Mock
+else:
+    from mock import MagicMock, Mock
+
+
+def _job_queue(statuses):
+    job_queue = Mock()
+    job_queue.__len__ = Mock(side_effect=lambda: len(statuses))
+    job_queue.getJobStatus.side_effect = lambda queue_index: statuses[queue_index]
+    return job_queue
+
+
+class JobQueueWatcherTest(unittest.TestCase):
+    def test_no_job_queue(self):
+        publish = Mock()
+        watcher = JobQueueWatcher(lambda: None, publish)
+
+        self.assertEqual({}, watcher.poll())
+        publish.assert_not_called()
+
+    def test_only_transitions_are_published(self):
+        statuses = [JobStatusType.JOB_QUEUE_WAITING, JobStatusType.JOB_QUEUE_WAITING]
+        job_queue = _job_queue(statuses)
+        publish = Mock()
+        watcher = JobQueueWatcher(lambda: job_queue, publish)
+
+        changes = watcher.poll()
+        self.assertEqual(
+            {
+                0: (None, JobStatusType.JOB_QUEUE_WAITING),
+                1: (None, JobStatusType.JOB_QUEUE_WAITING),
+            },
+            changes,
+        )
+
+        self.assertEqual({}, watcher.poll())
+        self.assertEqual(1, publish.call_count)
+
+        statuses[1] = JobStatusType.JOB_QUEUE_RUNNING
+        changes = watcher.poll()
+        self.assertEqual(
+            {1: (JobStatusType.JOB_QUEUE_WAITING, JobStatusType.JOB_QUEUE_RUNNING)},
+            changes,
+        )
+        self.assertEqual(2, publish.call_count)
+        event = publish.call_args[0][0]
+        self.assertEqual(changes, event.changes)
+
+    def test_new_job_queue_is_reported_from_start(self):
+        queues = [_job_queue([JobStatusType.JOB_QUEUE_DONE])]
+        watcher = JobQueueWatcher(lambda: queues[-1], Mock())
+        watcher.poll()
+
+        queues.append(_job_queue([JobStatusType.JOB_QUEUE_DONE]))
+        self.assertEqual({0: (None, JobStatusType.JOB_QUEUE_DONE)}, watcher.poll())
+
+    def test_job_statuses_are_read_holding_the_queue_lock(self):
+        queue_lock = MagicMock()
+        job_queue = _job_queue([JobStatusType.JOB_QUEUE_RUNNING])
+        job_queue.getJobStatus.side_effect = lambda queue_index: (
+            queue_lock.__enter__.called and not queue_lock.__exit__.called
+        )
+        watcher = JobQueueWatcher(lambda: job_queue, Mock(), queue_lock=queue_lock)
+
+        self.assertEqual({0: (None, True)}, watcher.poll())
+
+    def test_stop_publishes_last_transitions(self):
+        job_queue = _job_queue([JobStatusType.JOB_QUEUE_SUCCESS])
+        publish = Mock()
+        watcher = JobQueueWatcher(lambda: job_queue, publish, poll_interval=60)
+        watcher.start()
+        watcher.stop()
+
+        publish.assert_called_once()
+
+    def test_status_counts_follow_transitions(self):
+        statuses = [JobStatusType.JOB_QUEUE_WAITING] * 3
+        job_queue = _job_queue(statuses)
+        watcher = JobQueueWatcher(lambda: job_queue, Mock())
+
+        self.assertEqual({}, watcher.getStatusCounts())
+        watcher.poll()
+        self.assertEqual(
+            {JobStatusType.JOB_QUEUE_WAITING: 3}, watcher.getStatusCounts()
+        )
+
+        statuses[0] = JobStatusType.JOB_QUEUE_RUNNING
+        statuses[1] = JobStatusType.JOB_QUEUE_RUNNING
+        watcher.poll()
+        statuses[0] = JobStatusType.JOB_QUEUE_SUCCESS
+        watcher.poll()
+        self.assertEqual(
+            {
+                JobStatusType.JOB_QUEUE_WAITING: 1,
+                JobStatusType.JOB_QUEUE_RUNNING: 1,
+                JobStatusType.JOB_QUEUE_SUCCESS: 1,
+            },
+            watcher.getStatusCounts(),
+        )
+
+    def test_status_counts_do_not_read_job_statuses(self):
+        job_queue = _job_queue([JobStatusType.JOB_QUEUE_RUNNING] * 2)
+        publish = Mock()
+        watcher = JobQueueWatcher(lambda: job_queue, publish)
+
+        self.assertEqual({}, watcher.getStatusCounts())
+        job_queue.getJobStatus.assert_not_called()
+        publish.assert_not_called()
+
+        watcher.poll()
+        job_queue.getJobStatus.reset_mock()
+        publish.reset_mock()
+        self.assertEqual(
+            {JobStatusType.JOB_QUEUE_RUNNING: 2}, watcher.getStatusCounts()
+        )
+        job_queue.getJobStatus.assert_not_called()
+        publish.assert_not_called()
+
+    def test_stragglers_exceed_percentile_of_completed_runtimes(self):
+        statuses = [JobStatusType.JOB_QUEUE_RUNNING] * 7
+        job_queue = _job_queue(statuses)
+        publish = Mock()
+        now = [0]
+        watcher = JobQueueWatcher(
+            lambda: job_queue, publish, straggler_percentile=90, clock=lambda: now[0]
+        )
+        watcher.poll()
+
+        for queue_index in range(5):
+            self.assertEqual({}, watcher.getStragglers())
+            now[0] += 10
+            statuses[queue_index] = JobStatusType.JOB_QUEUE_SUCCESS
+            watcher.poll()
+
+        # The completed runtimes are 10, 20, 30, 40 and 50 seconds
+        self.assertEqual({5: 50, 6: 50}, watcher.getStragglers())
+        event = publish.call_args[0][0]
+        self.assertEqual({5: 50, 6: 50}, event.stragglers)
+        self.assertEqual(46, event.runtime_limit)
+
+        publish.reset_mock()
+        now[0] += 1
+        watcher.poll()
+        publish.assert_not_called()
+
+        statuses[5] = JobStatusType.JOB_QUEUE_SUCCESS
+        watcher.poll()
+        self.assertEqual([6], list(watcher.getStragglers()))
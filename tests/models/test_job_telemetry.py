@@ -0,0 +1,77 @@
+import datetime
+import sys
+import unittest
+
+from ert_shared.models.job_telemetry import JobTelemetry
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import Mock
+else:
+    from mock import Mock
+
+
+def _job(name, status, runtime=None, max_memory_usage=None):
+    job = Mock()
+    job.name = name
+    job.status = status
+    job.start_time = None
+    job.end_time = None
+    if runtime is not None:
+        job.start_time = datetime.datetime(2020, 1, 1)
+        job.end_time = job.start_time + datetime.timedelta(seconds=runtime)
+    job.max_memory_usage = max_memory_usage
+    return job
+
+
+class JobTelemetryTest(unittest.TestCase):
+    def test_successful_jobs_are_summarized_per_name(self):
+        telemetry = JobTelemetry()
+        for iens in range(20):
+            telemetry.record(
+                0,
+                iens,
+                [
+                    _job("ECLIPSE100", "Success", iens + 1, (iens + 1) * 1000),
+                    _job("RMS", "Running"),
+                ],
+            )
+
+        summary = telemetry.summary()
+        self.assertEqual(["ECLIPSE100"], list(summary))
+        self.assertEqual(20, summary["ECLIPSE100"]["count"])
+        self.assertEqual(
+            {"max": 20.0, "p50": 10.5, "p95": 19.05}, summary["ECLIPSE100"]["runtime"]
+        )
+        self.assertEqual(20000.0, summary["ECLIPSE100"]["max_memory_usage"]["max"])
+
+    def test_jobs_are_recorded_once(self):
+        telemetry = JobTelemetry()
+        jobs = [_job("ECLIPSE100", "Success", 10)]
+        telemetry.record(0, 0, jobs)
+        telemetry.record(0, 0, jobs)
+        self.assertEqual(1, telemetry.summary()["ECLIPSE100"]["count"])
+
+        telemetry.record(1, 0, jobs)
+        self.assertEqual(2, telemetry.summary()["ECLIPSE100"]["count"])
+        self.assertEqual(1, telemetry.summary(iteration=1)["ECLIPSE100"]["count"])
+
+    def test_missing_statistics_are_none(self):
+        telemetry = JobTelemetry()
+        telemetry.record(0, 0, [_job("COPY_FILE", "Success")])
+
+        summary = telemetry.summary()["COPY_FILE"]
+        self.assertEqual(1, summary["count"])
+        self.assertEqual({"max": None, "p50": None, "p95": None}, summary["runtime"])
+        self.assertIsNone(summary["max_memory_usage"]["p95"])
+
+    def test_reset_forgets_recorded_jobs(self):
+        telemetry = JobTelemetry()
+        jobs = [_job("ECLIPSE100", "Success", 10)]
+        telemetry.record(0, 0, jobs)
+        self.assertEqual(1, telemetry.summary()["ECLIPSE100"]["count"])
+
+        telemetry.reset()
+        self.assertEqual({}, telemetry.summary())
+
+        telemetry.record(0, 0, jobs)
+        self.assertEqual(1, telemetry.summary()["ECLIPSE100"]["count"])
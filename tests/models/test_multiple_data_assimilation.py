@@ -0,0 +1,113 @@
+import sys
+import threading
+
+from ert_shared.models.multiple_data_assimilation import MultipleDataAssimilation
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import MagicMock, patch
+else:
+    from mock import MagicMock, patch
+
+
+def _run_context(sim_fs, target_fs, mask, runpath_fmt, jobname_fmt, subst_list, itr):
+    run_context = MagicMock()
+    run_context.get_iter.return_value = itr
+    return run_context
+
+
+def _run_forward_models(run_context, runpath_creation=None):
+    if runpath_creation is not None:
+        runpath_creation.wait()
+    return 5
+
+
+def _run_model(arguments, create_runpath, store, extract=lambda reference: None):
+    module = "ert_shared.models.multiple_data_assimilation"
+    with patch(module + ".ERT") as ert, patch(
+        "ert_shared.models.base_run_model.ERT", ert
+    ), patch("ert_shared.models.base_run_model.EnkfSimulationRunner"), patch(
+        "ert_shared.models.base_run_model.JobQueueRunner"
+    ) as job_queue_runner, patch(
+        module + ".ErtRunContext.ensemble_smoother", side_effect=_run_context
+    ), patch(
+        module + ".dump_to_new_storage",
+        side_effect=lambda reference=None, job_statistics=None: store(),
+    ), patch(
+        module + ".extract_from_libres", side_effect=extract
+    ), patch(
+        module + ".dump_extraction",
+        side_effect=lambda extraction, job_statistics=None: store(),
+    ):
+        ert.ert.analysisConfig.return_value.get_stop_long_running.return_value = False
+        runner = ert.ert.getEnkfSimulationRunner.return_value
+        runner.createRunPath.side_effect = create_runpath
+        job_queue_runner.return_value.run.side_effect = _run_forward_models
+
+        model = MultipleDataAssimilation()
+        model.initial_realizations_mask = [True] * 5
+        model.runSimulations(arguments)
+    return model
+
+
+def _arguments(pipelined):
+    return {
+        "active_realizations": [True] * 5,
+        "target_case": "iter_%d",
+        "analysis_module": "STD_ENKF",
+        "weights": "2, 1",
+        "pipelined": pipelined,
+    }
+
+
+def test_runpath_creation():
+    runpaths_created = []
+    dumps = []
+
+    model = _run_model(
+        _arguments(pipelined=False),
+        lambda run_context: runpaths_created.append(run_context.get_iter()),
+        lambda: dumps.append(list(runpaths_created)),
+    )
+
+    assert dumps == [[0], [0, 1], [0, 1, 2]]
+    assert model._run_context.get_iter() == 2
+
+    summary = {name: count for name, _, count in model.profiler().summary()}
+    assert summary["Create runpaths"] == 3
+    assert summary["Forward models"] == 3
+    assert summary["Update"] == 2
+    assert summary["Store results"] == 3
+
+
+def test_pipelined_runpath_creation_overlaps_storage():
+    runpaths_created = []
+    created = {iteration: threading.Event() for iteration in range(3)}
+
+    def create_runpath(run_context):
+        runpaths_created.append(run_context.get_iter())
+        created[run_context.get_iter()].set()
+
+    extractions = []
+    dumps = []
+
+    def extract_from_libres(reference):
+        # The results are read from libres before the runpaths of the next
+        # iteration are created, as EnKFMain is not thread safe
+        extractions.append(list(runpaths_created))
+
+    def store():
+        # The runpaths of the next iteration are created while storing the
+        # results of the previous one, so waiting for them here must not block
+        next_iteration = len(dumps) + 1
+        if next_iteration in created:
+            assert created[next_iteration].wait(5)
+        dumps.append(list(runpaths_created))
+
+    model = _run_model(
+        _arguments(pipelined=True), create_runpath, store, extract_from_libres
+    )
+
+    assert runpaths_created == [0, 1, 2]
+    assert extractions == [[0], [0, 1]]
+    assert dumps == [[0, 1], [0, 1, 2], [0, 1, 2]]
+    assert model._run_context.get_iter() == 2
@@ -0,0 +1,91 @@
+import json
+import os
+import shutil
+import tempfile
+import threading
+import unittest
+
+from ert_shared.models.phase_profiler import PhaseProfiler
+
+
+class PhaseProfilerTest(unittest.TestCase):
+    def setUp(self):
+        self.now = [100.0]
+        self.profiler = PhaseProfiler(clock=lambda: self.now[0])
+
+    def _run(self, name, duration, category="phase"):
+        with self.profiler.span(name, category):
+            self.now[0] += duration
+
+    def test_summary(self):
+        self._run("Forward models", 60)
+        self._run("Update", 5)
+        self._run("Forward models", 30)
+
+        self.assertEqual(
+            [("Forward models", 90, 2), ("Update", 5, 1)], self.profiler.summary()
+        )
+        lines = self.profiler.formatSummary().splitlines()
+        self.assertEqual(3, len(lines))
+        self.assertTrue(lines[1].startswith("Forward models"))
+
+    def test_record(self):
+        start = self.profiler.now()
+        self.now[0] += 30
+
+        self.profiler.record("Queue wait", start, self.profiler.now(), "queue")
+
+        [span] = self.profiler.spans()
+        self.assertEqual(("Queue wait", "queue", 100.0, 30), span[:4])
+
+    def test_span_is_recorded_on_error(self):
+        with self.assertRaises(ValueError):
+            with self.profiler.span("Update"):
+                raise ValueError()
+
+        self.assertEqual(["Update"], [span.name for span in self.profiler.spans()])
+
+    def test_reset_forgets_spans(self):
+        self._run("Forward models", 60)
+        self.profiler.reset()
+        self._run("Update", 5)
+
+        self.assertEqual([("Update", 5, 1)], self.profiler.summary())
+
+    def test_chrome_trace(self):
+        with self.profiler.span("Simulations", "run"):
+            self.now[0] += 1
+            self._run("PRE_SIMULATION workflows", 2, category="workflow")
+
+        thread = threading.Thread(
+            name="runpath_thread", target=self._run, args=("Create runpaths", 3)
+        )
+        thread.start()
+        thread.join()
+
+        tmp_dir = tempfile.mkdtemp()
+        try:
+            path = os.path.join(tmp_dir, "trace.json")
+            self.profiler.writeChromeTrace(path)
+            with open(path) as trace_file:
+                trace = json.load(trace_file)
+        finally:
+            shutil.rmtree(tmp_dir)
+
+        spans = [event for event in trace["traceEvents"] if event["ph"] == "X"]
+        self.assertEqual(
+            [
+                ("Simulations", "run", 0, 3000000),
+                ("PRE_SIMULATION workflows", "workflow", 1000000, 2000000),
+                ("Create runpaths", "phase", 3000000, 3000000),
+            ],
+            [(span["name"], span["cat"], span["ts"], span["dur"]) for span in spans],
+        )
+
+        threads = {
+            event["tid"]: event["args"]["name"]
+            for event in trace["traceEvents"]
+            if event["ph"] == "M"
+        }
+        self.assertEqual("runpath_thread", threads[spans[2]["tid"]])
+        self.assertNotEqual(spans[0]["tid"], spans[2]["tid"])
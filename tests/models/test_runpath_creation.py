@@ -0,0 +1,132 @@
+import os
+import shutil
+import sys
+import tempfile
+import threading
+import unittest
+
+from ert_shared.models import BaseRunModel
+from ert_shared.models.runpath_creation import RunpathCreation
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import Mock, patch
+else:
+    from mock import Mock, patch
+
+
+def _run_context(runpaths, active):
+    run_context = Mock()
+    run_context.__len__ = Mock(return_value=len(runpaths))
+    run_context.is_active.side_effect = lambda iens: active[iens]
+    run_args = []
+    for runpath in runpaths:
+        run_arg = Mock()
+        run_arg.runpath = runpath
+        run_args.append(run_arg)
+    run_context.__getitem__ = Mock(side_effect=lambda iens: run_args[iens])
+    return run_context
+
+
+def _write_jobs_file(runpath):
+    if not os.path.isdir(runpath):
+        os.makedirs(runpath)
+    with open(os.path.join(runpath, RunpathCreation.JOBS_FILE), "w") as jobs_file:
+        jobs_file.write("{}")
+
+
+class RunpathCreationTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp_dir = tempfile.mkdtemp()
+        self.runpaths = [
+            os.path.join(self.tmp_dir, "realization-{}".format(iens))
+            for iens in range(3)
+        ]
+
+    def tearDown(self):
+        shutil.rmtree(self.tmp_dir)
+
+    def test_ready_realizations(self):
+        run_context = _run_context(self.runpaths, [True, False, True])
+        first_created = threading.Event()
+        proceed = threading.Event()
+
+        def create_runpath(context):
+            _write_jobs_file(self.runpaths[0])
+            first_created.set()
+            proceed.wait(5)
+            _write_jobs_file(self.runpaths[2])
+
+        creation = RunpathCreation(run_context, create_runpath)
+        self.assertEqual(2, creation.activeCount())
+
+        self.assertTrue(first_created.wait(5))
+        self.assertIsNone(creation.wait(0))
+        self.assertEqual([0], creation.readyRealizations())
+
+        proceed.set()
+        self.assertIs(run_context, creation.wait(5))
+        self.assertEqual([0, 2], creation.readyRealizations())
+
+    def test_jobs_files_of_earlier_runs_are_not_ready(self):
+        run_context = _run_context(self.runpaths, [True, True, False])
+        for runpath in self.runpaths:
+            _write_jobs_file(runpath)
+        second_created = threading.Event()
+        proceed = threading.Event()
+
+        def create_runpath(context):
+            _write_jobs_file(self.runpaths[1])
+            second_created.set()
+            proceed.wait(5)
+            _write_jobs_file(self.runpaths[0])
+
+        creation = RunpathCreation(run_context, create_runpath)
+        self.assertTrue(second_created.wait(5))
+        self.assertEqual([1], creation.readyRealizations())
+        # Inactive realizations are left alone
+        self.assertTrue(
+            os.path.exists(os.path.join(self.runpaths[2], RunpathCreation.JOBS_FILE))
+        )
+
+        proceed.set()
+        self.assertIs(run_context, creation.wait(5))
+        self.assertEqual([1, 0], creation.readyRealizations())
+
+    def test_errors_are_raised_when_waiting(self):
+        run_context = _run_context(self.runpaths, [True, True, True])
+
+        def create_runpath(context):
+            raise ValueError("No space left on device")
+
+        creation = RunpathCreation(run_context, create_runpath)
+        with self.assertRaises(ValueError):
+            creation.wait(5)
+
+    def test_progress_is_reported_in_phase_name(self):
+        run_context = _run_context(self.runpaths, [True, True, True])
+        created = threading.Event()
+
+        def create_runpath(context):
+            _write_jobs_file(self.runpaths[0])
+            created.wait(5)
+
+        brm = BaseRunModel(None)
+        brm.RUNPATH_POLL_INTERVAL = 0.01
+        brm.setPhaseName("Pre processing...")
+        state_changes = brm.subscribe()
+
+        with patch("ert_shared.models.base_run_model.ERT") as ert:
+            runner = ert.ert.getEnkfSimulationRunner.return_value
+            runner.createRunPath.side_effect = create_runpath
+            timer = threading.Timer(0.2, created.set)
+            timer.start()
+            self.assertIs(run_context, brm.createRunPath(run_context))
+            timer.join()
+
+        phase_names = []
+        while not state_changes.empty():
+            phase_names.append(state_changes.get_nowait().phase_name)
+
+        self.assertIn("Creating runpaths: 1 of 3 realizations ready", phase_names)
+        self.assertEqual("Pre processing...", phase_names[-1])
+        self.assertEqual("Pre processing...", brm.getPhaseName())
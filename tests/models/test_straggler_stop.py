@@ -0,0 +1,113 @@
+import sys
+import threading
+import unittest
+
+from ert_shared.models import BaseRunModel
+from ert_shared.models.straggler_stop import StragglerStop
+from res.job_queue import JobStatusType
+
+if sys.version_info >= (3, 3):
+    from unittest.mock import Mock, patch
+else:
+    from mock import Mock, patch
+
+
+def _model(statuses, min_realizations):
+    model = Mock()
+    model._queue_lock = threading.Lock()
+    model._job_queue = Mock()
+    model._job_queue.__len__ = Mock(side_effect=lambda: len(statuses))
+    model._job_queue.getJobStatus.side_effect = lambda idx: statuses[idx]
+
+    def status_counts():
+        counts = {}
+        for status in statuses:
+            counts[status] = counts.get(status, 0) + 1
+        return counts
+
+    model.getQueueStatus.side_effect = status_counts
+    model.haveSufficientRealizations.side_effect = (
+        lambda succeeded: succeeded >= min_realizations
+    )
+    return model
+
+
+class StragglerStopTest(unittest.TestCase):
+    def test_stragglers_are_killed_after_timeout(self):
+        statuses = [
+            JobStatusType.JOB_QUEUE_SUCCESS,
+            JobStatusType.JOB_QUEUE_RUNNING,
+            JobStatusType.JOB_QUEUE_RUNNING,
+        ]
+        model = _model(statuses, min_realizations=2)
+        straggler_stop = StragglerStop(model, straggler_timeout=60)
+
+        self.assertEqual([], straggler_stop.check(now=0))
+
+        statuses[1] = JobStatusType.JOB_QUEUE_SUCCESS
+        self.assertEqual([], straggler_stop.check(now=10))
+        self.assertEqual([], straggler_stop.check(now=69))
+        model._job_queue.kill_job.assert_not_called()
+
+        self.assertEqual([2], straggler_stop.check(now=70))
+        model._job_queue.kill_job.assert_called_once_with(2)
+
+        self.assertEqual([], straggler_stop.check(now=80))
+        self.assertEqual(1, model._job_queue.kill_job.call_count)
+
+    def test_finished_jobs_are_not_killed(self):
+        statuses = [
+            JobStatusType.JOB_QUEUE_SUCCESS,
+            JobStatusType.JOB_QUEUE_FAILED,
+            JobStatusType.JOB_QUEUE_RUNNING_DONE_CALLBACK,
+            JobStatusType.JOB_QUEUE_PENDING,
+        ]
+        model = _model(statuses, min_realizations=1)
+        straggler_stop = StragglerStop(model, straggler_timeout=0)
+
+        self.assertEqual([3], straggler_stop.check(now=0))
+
+    def test_new_job_queue_starts_over(self):
+        statuses = [JobStatusType.JOB_QUEUE_SUCCESS, JobStatusType.JOB_QUEUE_RUNNING]
+        model = _model(statuses, min_realizations=1)
+        straggler_stop = StragglerStop(model, straggler_timeout=60)
+
+        self.assertEqual([], straggler_stop.check(now=0))
+
+        first_queue = model._job_queue
+        statuses[0] = JobStatusType.JOB_QUEUE_RUNNING
+        model._job_queue = Mock()
+        model._job_queue.__len__ = Mock(side_effect=lambda: len(statuses))
+        model._job_queue.getJobStatus.side_effect = lambda idx: statuses[idx]
+
+        self.assertEqual([], straggler_stop.check(now=100))
+        first_queue.kill_job.assert_not_called()
+        model._job_queue.kill_job.assert_not_called()
+
+
+class StopLongRunningTest(unittest.TestCase):
+    def _evaluators(self, stop_long_running):
+        with patch("ert_shared.models.base_run_model.ERT") as ert, patch(
+            "ert_shared.models.base_run_model.JobQueueRunner"
+        ) as job_queue_runner:
+            analysis_config = ert.ert.analysisConfig.return_value
+            analysis_config.get_stop_long_running.return_value = stop_long_running
+            analysis_config.minimum_required_realizations = 2
+
+            brm = BaseRunModel(None)
+            brm._job_queue = Mock()
+            brm.runSimpleStep(Mock(), straggler_timeout=60)
+        return job_queue_runner.call_args[0][4], brm._job_queue
+
+    def test_straggler_timeout_is_used_without_stop_long_running(self):
+        evaluators, _ = self._evaluators(stop_long_running=False)
+
+        self.assertEqual(1, len(evaluators))
+        self.assertIsInstance(evaluators[0].__self__, StragglerStop)
+
+    def test_stop_long_running_takes_precedence(self):
+        evaluators, job_queue = self._evaluators(stop_long_running=True)
+
+        self.assertEqual(1, len(evaluators))
+        self.assertIs(job_queue.stop_long_running_jobs, evaluators[0].func)
+        self.assertEqual((2,), evaluators[0].args)
@@ -1,4 +1,6 @@
 import os
+import pandas as pd
+from mock import MagicMock, patch
 from pandas.core.base import PandasObject
 
 from res.enkf import EnKFMain, ResConfig
@@ -164,3 +166,55 @@ class LibresFacadeTest(TestCase):
         facade = self.facade()
         data = facade.refcase_data('nokey')
         self.assertIsInstance(data, PandasObject)
+
+    @tmpdir(os.path.join(SOURCE_DIR, 'test-data/local/snake_oil'))
+    def test_gather_all_gen_kw_data(self):
+        facade = self.facade()
+        keys = [key for key in facade.all_data_type_keys() if facade.is_gen_kw_key(key)]
+
+        data = facade.gather_all_gen_kw_data('default_0', keys)
+
+        self.assertEqual(keys, list(data.columns))
+        for key in keys:
+            single = facade.gather_gen_kw_data('default_0', key)
+            self.assertTrue(data[[key]].dropna().equals(single))
+
+    @tmpdir(os.path.join(SOURCE_DIR, 'test-data/local/snake_oil'))
+    def test_gather_all_summary_data(self):
+        facade = self.facade()
+        keys = ['FOPR', 'BPR:1,3,8', 'WOPR:OP1']
+
+        data = facade.gather_all_summary_data('default_0', keys)
+
+        for key in keys:
+            self.assertTrue(data[key].equals(facade.gather_summary_data('default_0', key)))
+
+    def test_gather_all_summary_data_drops_duplicate_timestamps(self):
+        index = pd.MultiIndex.from_tuples(
+            [(0, "2010-01-01"), (0, "2010-01-01"), (0, "2010-01-02"), (1, "2010-01-01"), (1, "2010-01-02")],
+            names=["Realization", "Date"]
+        )
+        summary = pd.DataFrame({"FOPR": [1.0, 1.0, 2.0, 3.0, 4.0], "FGPR": [5.0, 5.0, 6.0, 7.0, 8.0]}, index=index)
+        facade = LibresFacade(MagicMock())
+
+        with patch("ert_shared.libres_facade.SummaryCollector") as collector:
+            collector.loadAllSummaryData.return_value = summary
+            data = facade.gather_all_summary_data("default", ["FOPR", "FGPR"])
+
+        self.assertEqual(["2010-01-01", "2010-01-02"], list(data.index))
+        self.assertEqual([[1.0, 3.0], [2.0, 4.0]], data["FOPR"].values.tolist())
+        self.assertEqual([[5.0, 7.0], [6.0, 8.0]], data["FGPR"].values.tolist())
+        self.assertEqual("Realization", data["FOPR"].columns.name)
+
+    def test_gather_all_summary_data_rejects_timestamps_repeated_with_other_values(self):
+        index = pd.MultiIndex.from_tuples(
+            [(0, "2010-01-01"), (0, "2010-01-01"), (1, "2010-01-01")],
+            names=["Realization", "Date"]
+        )
+        summary = pd.DataFrame({"FOPR": [1.0, 2.0, 3.0]}, index=index)
+        facade = LibresFacade(MagicMock())
+
+        with patch("ert_shared.libres_facade.SummaryCollector") as collector:
+            collector.loadAllSummaryData.return_value = summary
+            with self.assertRaises(ValueError):
+                facade.gather_all_summary_data("default", ["FOPR"])
@@ -0,0 +1,20 @@
+from ert_shared.storage.connections import get_rdb_connection
+from ert_shared.storage.model import Entities, JobStatistics
+from sqlalchemy import create_engine, inspect
+
+
+def test_tables_missing_in_existing_database_are_created(tmpdir):
+    db_url = "sqlite:///{}/entities.db".format(tmpdir)
+    engine = create_engine(db_url, echo=False)
+    tables = [
+        table
+        for table in Entities.metadata.sorted_tables
+        if table is not JobStatistics.__table__
+    ]
+    Entities.metadata.create_all(engine, tables=tables)
+    assert "job_statistics" not in inspect(engine).get_table_names()
+
+    connection = get_rdb_connection(db_url, pragma_foreign_keys=False)
+
+    assert "job_statistics" in inspect(connection).get_table_names()
+    connection.close()
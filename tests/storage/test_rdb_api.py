@@ -188,6 +188,30 @@ def test_add_realization(db_connection):
         rdb_api.commit()
 
 
+def test_add_job_statistics(db_connection):
+    statistics = {
+        "count": 3,
+        "runtime": {"max": 30.0, "p50": 20.0, "p95": 29.0},
+        "max_memory_usage": {"max": None, "p50": None, "p95": None},
+    }
+    with RdbApi(db_connection) as rdb_api:
+        ensemble = rdb_api.add_ensemble(name="test_ensemble")
+        rdb_api.add_job_statistics("ECLIPSE100", statistics, ensemble.name)
+        rdb_api.commit()
+
+        job_statistics = rdb_api.get_job_statistics_by_ensemble_id(ensemble.id).one()
+        assert job_statistics.name == "ECLIPSE100"
+        assert job_statistics.count == 3
+        assert job_statistics.runtime_p95 == 29.0
+        assert job_statistics.max_memory_usage_max is None
+
+    with pytest.raises(sqlalchemy.exc.IntegrityError), RdbApi(
+        connection=db_connection
+    ) as rdb_api:
+        rdb_api.add_job_statistics("ECLIPSE100", statistics, ensemble.name)
+        rdb_api.commit()
+
+
 def test_add_parameter(db_connection):
     value = 22.1
 
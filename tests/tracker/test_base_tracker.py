@@ -1,4 +1,5 @@
 import sys
+import time
 import unittest
 
 from ert_shared.tracker.base import BaseTracker
@@ -53,3 +54,40 @@ class BaseTrackerTest(unittest.TestCase):
 
         self.assertEqual({}, detailed_event.details)
         self.assertEqual(-1, detailed_event.iteration)
+
+    def test_detailed_delta_event_generation(self):
+        self.model.getDetailedProgressChanges.side_effect = [
+            ({0: {0: "progress"}}, 0, 3),
+            ({}, 0, 3),
+            ({0: {0: "progress"}}, 0, 3),
+        ]
+
+        first = self.tracker._detailed_delta_event()
+        second = self.tracker._detailed_delta_event()
+
+        self.assertEqual({0: {0: "progress"}}, first.details)
+        self.assertTrue(first.delta)
+        self.assertEqual(3, first.sequence)
+        self.assertEqual({}, second.details)
+        self.model.getDetailedProgressChanges.assert_called_with(3)
+
+        self.tracker.reset()
+        self.tracker._detailed_delta_event()
+        self.model.getDetailedProgressChanges.assert_called_with(0)
+
+    def test_costly_updates_get_longer_intervals(self):
+        tracker = BaseTracker(self.model, max_poll_fraction=0.1)
+
+        def slow_event():
+            time.sleep(0.02)
+            return "event"
+
+        self.assertEqual(1, tracker._adapted_interval("detailed", 1))
+        self.assertEqual("event", tracker._measure("detailed", slow_event))
+
+        # 0.02 seconds is 5% of 0.4 seconds, the detailed share of the budget
+        self.assertEqual(1, tracker._adapted_interval("detailed", 1))
+        self.assertGreaterEqual(tracker._adapted_interval("detailed", 0.1), 0.4)
+        self.assertEqual(0, tracker._adapted_interval("detailed", 0))
+        self.assertGreater(tracker._poll_delay("detailed"), 0.3)
+        self.assertEqual(0, tracker._poll_delay("general"))
@@ -1,9 +1,10 @@
+import time
 import unittest
 
 from ert_shared.models import BaseRunModel
 from ert_shared.tracker.blocking import BlockingTracker
 from ert_shared.tracker.events import (DetailedEvent, EndEvent, GeneralEvent,
-                                       TickEvent)
+                                       JobStatusChangeEvent, TickEvent)
 
 
 class BlockingTrackerTest(unittest.TestCase):
@@ -30,3 +31,38 @@ class BlockingTrackerTest(unittest.TestCase):
         for idx, ev_cls in enumerate([TickEvent, GeneralEvent, DetailedEvent,
                                       EndEvent]):
             self.assertIsInstance(events[idx], ev_cls)
+
+    def test_state_change_yields_general_event_before_next_tick(self):
+        brm = BaseRunModel(None, phase_count=1)
+        tracker = BlockingTracker(brm, 1, 10, 0)
+
+        events = tracker.track()
+        self.assertIsInstance(next(events), TickEvent)
+        self.assertIsInstance(next(events), GeneralEvent)
+
+        brm.publish(JobStatusChangeEvent({0: (None, 1)}))
+        brm.publish(JobStatusChangeEvent({0: (1, 2)}))
+        start = time.time()
+        self.assertIsInstance(next(events), GeneralEvent)
+        self.assertLess(time.time() - start, 0.5)
+
+        # Both changes are consumed by a single update
+        self.assertIsInstance(next(events), TickEvent)
+        events.close()
+        self.assertEqual([], brm._subscribers)
+
+    def test_phase_change_ends_tracking_without_waiting_for_tick(self):
+        brm = BaseRunModel(None, phase_count=1)
+        tracker = BlockingTracker(brm, 1, 1, 1)
+
+        events = tracker.track()
+        for _ in range(3):
+            next(events)
+
+        start = time.time()
+        brm.setPhase(1, "Simulations completed.")
+        remaining = list(events)
+        self.assertLess(time.time() - start, 0.5)
+        for idx, ev_cls in enumerate([TickEvent, GeneralEvent, DetailedEvent,
+                                      EndEvent]):
+            self.assertIsInstance(remaining[idx], ev_cls)
@@ -1,9 +1,10 @@
 import sys
+import time
 import unittest
 
 from ert_shared.models import BaseRunModel
 from ert_shared.tracker.events import (DetailedEvent, EndEvent, GeneralEvent,
-                                       TickEvent)
+                                       JobStatusChangeEvent, TickEvent)
 from ert_shared.tracker.qt import QTimerTracker
 
 if sys.version_info >= (3, 3):
@@ -47,3 +48,59 @@ class QTimerTrackerTest(unittest.TestCase):
 
         for timer in tracker._qtimers:
             timer.stop.assert_called_once()
+
+    def test_state_change_emits_general_event(self):
+        event_handler = Mock()
+        signal = Mock()
+        brm = BaseRunModel(None, phase_count=1)
+        tracker = QTimerTracker(brm, Mock, 1, 5, 10, event_handler,
+                                state_change_signal=signal)
+        tracker._deferred_state_change.isActive.return_value = False
+        signal.connect.assert_called_once_with(tracker._state_change)
+        tracker.track()
+
+        brm.publish(JobStatusChangeEvent({0: (None, 1)}))
+        signal.emit.assert_called_once()
+        tracker._state_change()
+        event_handler.assert_called_once()
+        _, args, _ = event_handler.mock_calls[0]
+        self.assertIsInstance(args[0], GeneralEvent)
+
+        tracker.stop()
+        self.assertEqual([], brm._subscribers)
+
+    def test_state_change_is_deferred_by_polling_budget(self):
+        event_handler = Mock()
+        brm = BaseRunModel(None, phase_count=1)
+        tracker = QTimerTracker(brm, Mock, 1, 5, 10, event_handler,
+                                state_change_signal=Mock())
+        tracker._deferred_state_change.isActive.return_value = False
+        tracker.track()
+        tracker._poll_costs["general"] = 1.0
+        tracker._last_polls["general"] = time.time()
+
+        tracker._state_change()
+
+        event_handler.assert_not_called()
+        tracker._deferred_state_change.start.assert_called_once()
+        tracker.stop()
+
+    def test_state_changes_are_not_followed_without_signal(self):
+        brm = BaseRunModel(None, phase_count=1)
+        tracker = QTimerTracker(brm, Mock, 1, 5, 10, Mock())
+        tracker.track()
+
+        self.assertEqual([], brm._subscribers)
+
+    def test_costly_updates_slow_down_timer(self):
+        brm = BaseRunModel(None, phase_count=1)
+        tracker = QTimerTracker(brm, Mock, 1, 0, 1, Mock(), max_poll_fraction=0.1)
+        detailed_timer = tracker._qtimers[1]
+        detailed_timer.interval.return_value = 1000
+        tracker._poll_costs["detailed"] = 0.5
+
+        tracker._detailed()
+
+        # The smoothed cost is still well above the 0.05 second share
+        interval = detailed_timer.setInterval.call_args[0][0]
+        self.assertGreater(interval, 4000)